@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_BENCHMARKS_BENCH_H
+#define INERTIA_BENCHMARKS_BENCH_H
+
+/// @file Bench.h
+/// @brief Provides the timing helpers shared by the benchmarks.
+
+#include <inr/Support/Stream.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace inr::bench {
+
+/// @brief Written to by `keep()`, so the compiler can't drop the results.
+inline volatile std::size_t sink;
+
+/// @brief Keeps a computed value alive.
+inline void keep(std::size_t v) {
+    sink = sink + v;
+}
+
+/// @brief Runs `fn` `runs` times and returns the fastest run in nanoseconds.
+template<typename Fn>
+std::uint64_t measure(Fn&& fn, unsigned runs = 5) {
+    std::uint64_t best = UINT64_MAX;
+    for(unsigned i = 0; i < runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+
+        std::uint64_t ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count();
+        if(ns < best) best = ns;
+    }
+    return best;
+}
+
+/// @brief Prints one result line, the time per operation and the throughput.
+inline void report(std::string_view name, std::uint64_t ns, std::size_t ops) {
+    std::uint64_t centi = ns * 100 / ops;
+
+    out() << name;
+    out().indent(name.size() < 40 ? 40 - name.size() : 1);
+    out() << centi / 100 << '.' << (centi % 100 < 10 ? "0" : "")
+          << centi % 100 << " ns/op  " << ops * 1000 / (ns ? ns : 1)
+          << " Mop/s\n";
+}
+
+/// @brief Prints one result line for a pass over `bytes` bytes of input.
+inline void reportBytes(std::string_view name, std::uint64_t ns,
+                        std::size_t bytes) {
+    out() << name;
+    out().indent(name.size() < 40 ? 40 - name.size() : 1);
+    out() << std::uint64_t(bytes) * 1000 / (ns ? ns : 1) << " MB/s  ("
+          << bytes << " bytes in " << ns / 1000 << " us)\n";
+}
+
+} // namespace inr::bench
+
+#endif // INERTIA_BENCHMARKS_BENCH_H
@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/BitVector.h>
+#include <inr/ADT/SmallBitVector.h>
+#include <inr/ADT/SparseBitVector.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// @brief Amount of times every operation is repeated per measurement.
+constexpr unsigned REPEAT = 64;
+
+std::uint32_t seed = 42;
+
+std::uint32_t nextRandom() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+/// @brief The bits to set, `density` out of 1000.
+std::vector<std::size_t> pickBits(std::size_t bits, unsigned density) {
+    std::vector<std::size_t> picked;
+    for(std::size_t i = 0; i < bits; i++) {
+        if(nextRandom() % 1000 < density) picked.push_back(i);
+    }
+    return picked;
+}
+
+/// @brief std::vector<bool> has no set operations, these are the loops a
+/// user would write.
+struct BoolVec {
+    std::vector<bool> bits_;
+
+    explicit BoolVec(std::size_t size) : bits_(size) {}
+
+    void set(std::size_t n) {
+        bits_[n] = true;
+    }
+
+    void unionWith(const BoolVec& other) {
+        for(std::size_t i = 0; i < bits_.size(); i++) {
+            if(other.bits_[i]) bits_[i] = true;
+        }
+    }
+
+    void intersectWith(const BoolVec& other) {
+        for(std::size_t i = 0; i < bits_.size(); i++) {
+            if(!other.bits_[i]) bits_[i] = false;
+        }
+    }
+
+    std::size_t count() const {
+        std::size_t count = 0;
+        for(bool b : bits_) count += b;
+        return count;
+    }
+
+    std::size_t sumSetBits() const {
+        std::size_t sum = 0;
+        for(std::size_t i = 0; i < bits_.size(); i++) {
+            if(bits_[i]) sum += i;
+        }
+        return sum;
+    }
+};
+
+template<typename BV>
+BV make(std::size_t bits, const std::vector<std::size_t>& picked) {
+    BV bv(bits);
+    for(std::size_t n : picked) bv.set(n);
+    return bv;
+}
+
+template<>
+inr::SparseBitVector make<inr::SparseBitVector>(
+    std::size_t, const std::vector<std::size_t>& picked) {
+    inr::SparseBitVector bv;
+    for(std::size_t n : picked) bv.set(n);
+    return bv;
+}
+
+template<typename BV>
+std::size_t sumSetBits(const BV& bv) {
+    if constexpr(requires { bv.sumSetBits(); }) {
+        return bv.sumSetBits();
+    }
+    else if constexpr(requires { bv.set_bits(); }) {
+        std::size_t sum = 0;
+        for(std::size_t i : bv.set_bits()) sum += i;
+        return sum;
+    }
+    else {
+        std::size_t sum = 0;
+        for(std::size_t i : bv) sum += i;
+        return sum;
+    }
+}
+
+/// @brief Times union, intersection, count and iteration of two sets.
+template<typename BV>
+void run(std::string_view name, std::size_t bits,
+         const std::vector<std::size_t>& a,
+         const std::vector<std::size_t>& b) {
+    BV lhs = make<BV>(bits, a);
+    BV rhs = make<BV>(bits, b);
+
+    std::uint64_t unite = inr::bench::measure([&] {
+        for(unsigned i = 0; i < REPEAT; i++) {
+            BV dst = lhs;
+            dst.unionWith(rhs);
+            inr::bench::keep(dst.count());
+        }
+    });
+
+    std::uint64_t intersect = inr::bench::measure([&] {
+        for(unsigned i = 0; i < REPEAT; i++) {
+            BV dst = lhs;
+            dst.intersectWith(rhs);
+            inr::bench::keep(dst.count());
+        }
+    });
+
+    std::uint64_t iterate = inr::bench::measure([&] {
+        for(unsigned i = 0; i < REPEAT; i++) inr::bench::keep(sumSetBits(lhs));
+    });
+
+    inr::out() << name << ":\n";
+    inr::bench::report("  copy + union + count", unite, REPEAT);
+    inr::bench::report("  copy + intersect + count", intersect, REPEAT);
+    inr::bench::report("  iterate set bits", iterate, REPEAT * a.size());
+}
+
+/// @brief Runs every bit vector over `bits` bits with `density` per mille set.
+void runSize(std::size_t bits, unsigned density) {
+    std::vector<std::size_t> a = pickBits(bits, density);
+    std::vector<std::size_t> b = pickBits(bits, density);
+
+    inr::out() << "== " << bits << " bits, " << a.size() << " set ==\n";
+    run<inr::BitVector>("BitVector", bits, a, b);
+    run<inr::SmallBitVector<256>>("SmallBitVector<256>", bits, a, b);
+    run<inr::SparseBitVector>("SparseBitVector", bits, a, b);
+    run<BoolVec>("std::vector<bool>", bits, a, b);
+    inr::out() << '\n';
+}
+
+} // namespace
+
+int main() {
+    // A block's worth of vregs, and a function's, dense then sparse.
+    runSize(256, 300);
+    runSize(1 << 16, 300);
+    runSize(1 << 16, 2);
+
+    inr::out().flush();
+    return 0;
+}
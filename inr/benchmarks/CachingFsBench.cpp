@@ -0,0 +1,60 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/CachingFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+/// @brief Probes every header in every include directory, like a compiler
+/// resolving `#include <name>` against a search path.
+static std::size_t probe(inr::vfs::Filesystem& fs,
+                         const std::vector<std::string>& paths) {
+    std::size_t found = 0;
+    for(const std::string& path : paths) found += fs.exists(path);
+    return found;
+}
+
+int main() {
+    const char* dirs[] = {"/usr/local/include", "/usr/include/x86_64-linux-gnu",
+                          "/usr/include/c++", "/usr/include"};
+    const char* headers[] = {"stdio.h",  "stdlib.h", "string.h", "errno.h",
+                             "unistd.h", "fcntl.h",  "stdint.h", "limits.h",
+                             "time.h",   "signal.h", "math.h",   "wchar.h"};
+
+    std::vector<std::string> paths;
+    for(unsigned i = 0; i < 100; i++) {
+        for(const char* header : headers) {
+            for(const char* dir : dirs) {
+                paths.push_back(std::string(dir) + '/' + header);
+            }
+        }
+    }
+
+    inr::vfs::Filesystem& native = inr::vfs::getNativeFs();
+    std::size_t found = 0;
+    std::uint64_t uncached =
+        inr::bench::measure([&] { found = probe(native, paths); });
+
+    inr::vfs::CachingFilesystem cache(native);
+    std::uint64_t cached = inr::bench::measure([&] {
+        if(probe(cache, paths) != found) found = 0;
+    });
+
+    inr::out() << "== " << paths.size() << " include probes, " << found
+               << " found ==\n";
+    inr::bench::report("  native stat", uncached, paths.size());
+    inr::bench::report("  stat cache", cached, paths.size());
+    cache.dumpStats(inr::out());
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/ConcurrentHMap.h>
+#include <inr/ADT/HMap.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t keyCount = 1 << 16;
+constexpr std::size_t opsPerThread = 1 << 20;
+
+/// @brief The alternative, one HMap behind one lock.
+class LockedMap {
+    std::mutex lock_;
+    inr::HMap<std::size_t, std::size_t> map_;
+
+public:
+    const std::size_t* try_emplace(std::size_t key, std::size_t val) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return map_.try_emplace(key, val).first;
+    }
+
+    const std::size_t* find(std::size_t key) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return map_.find(key);
+    }
+};
+
+class ShardedMap {
+    inr::ConcurrentHMap<std::size_t, std::size_t> map_;
+
+public:
+    const std::size_t* try_emplace(std::size_t key, std::size_t val) {
+        return map_.try_emplace(key, val).first;
+    }
+
+    const std::size_t* find(std::size_t key) {
+        return map_.find(key);
+    }
+};
+
+/// @brief Every thread interns one key out of 8 operations and looks up the
+/// rest, like threads compiling functions against a shared type table.
+template<typename Map>
+void run(std::string_view name, unsigned threadCount) {
+    std::unique_ptr<Map> map;
+
+    std::uint64_t ns = inr::bench::measure(
+        [&] {
+            map = std::make_unique<Map>();
+            for(std::size_t i = 0; i < keyCount / 2; i++) {
+                map->try_emplace(i, i);
+            }
+
+            std::vector<std::thread> threads;
+            for(unsigned t = 0; t < threadCount; t++) {
+                threads.emplace_back([&map, t] {
+                    std::size_t found = 0;
+                    std::size_t key = t * 0x9e3779b9;
+                    for(std::size_t i = 0; i < opsPerThread; i++) {
+                        key = key * 6364136223846793005ULL + 1;
+                        std::size_t k = (key >> 32) % keyCount;
+                        if(i % 8 == 0) map->try_emplace(k, k);
+                        else found += map->find(k) != nullptr;
+                    }
+                    inr::bench::keep(found);
+                });
+            }
+            for(auto& thread : threads) thread.join();
+        },
+        3);
+
+    std::string label(name);
+    label += ", ";
+    label += std::to_string(threadCount);
+    label += threadCount == 1 ? " thread" : " threads";
+    inr::bench::report(label, ns, opsPerThread * threadCount);
+}
+
+} // namespace
+
+int main() {
+    unsigned hw = std::thread::hardware_concurrency();
+    inr::out() << "== mixed find/intern (" << hw << " hardware threads) ==\n";
+
+    for(unsigned threads = 1; threads <= 8; threads *= 2) {
+        run<ShardedMap>("ConcurrentHMap", threads);
+        run<LockedMap>("HMap + mutex", threads);
+    }
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+/// @brief Sums every 64th byte, roughly what a lexer touches per line.
+static std::size_t touch(const char* p, std::size_t size) {
+    std::size_t sum = 0;
+    for(std::size_t i = 0; i < size; i += 64) sum += (unsigned char)p[i];
+    return sum;
+}
+
+int main() {
+    constexpr std::string_view PATH = "FSMapBench.tmp";
+    constexpr std::size_t SIZE = 64 * 1024 * 1024;
+    inr::vfs::Filesystem& fs = inr::vfs::getNativeFs();
+
+    std::error_code ec;
+    {
+        std::string data(SIZE, 'x');
+        auto f = fs.open(
+            PATH, inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec);
+        if(!f || f->write(data.data(), SIZE) != SIZE) return 1;
+    }
+
+    bool ok = true;
+    std::uint64_t read = inr::bench::measure([&] {
+        auto f = fs.open(PATH, inr::vfs::OREAD, ec);
+        std::unique_ptr<char[]> buf(new char[SIZE]);
+        ok &= f && f->read(buf.get(), SIZE) == SIZE;
+        inr::bench::keep(touch(buf.get(), SIZE));
+    });
+
+    auto mapped = [&](inr::vfs::Advice advice) {
+        return inr::bench::measure([&] {
+            auto m = fs.map(PATH, advice, ec);
+            ok &= m && m->isMapped();
+            if(m) inr::bench::keep(touch(m->data(), m->size()));
+        });
+    };
+    std::uint64_t normal = mapped(inr::vfs::Advice::Normal);
+    std::uint64_t sequential = mapped(inr::vfs::Advice::Sequential);
+    fs.rm(PATH);
+    if(!ok) return 1;
+
+    inr::out() << "== 64 MiB file, page cache warm ==\n";
+    inr::bench::reportBytes("  open, read into a buffer", read, SIZE);
+    inr::bench::reportBytes("  map", normal, SIZE);
+    inr::bench::reportBytes("  map, sequential advice", sequential, SIZE);
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+constexpr std::string_view PATH = "FSOutputBench.tmp";
+constexpr std::size_t SIZE = std::size_t(32) << 20;
+
+/// @brief Streams the artifact into `os`.
+static void emit(inr::stream& os, const std::string& chunk) {
+    for(std::size_t i = 0; i < SIZE; i += chunk.size()) os << chunk;
+    os.flush();
+}
+
+int main() {
+    inr::vfs::Filesystem& fs = inr::vfs::getNativeFs();
+    std::string chunk(4096, 'x');
+    std::error_code ec;
+    bool ok = true;
+
+    // Overwrites the destination in place, readers see it half written.
+    std::uint64_t truncated = inr::bench::measure([&] {
+        auto f = fs.open(
+            PATH, inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec);
+        if(!f) {
+            ok = false;
+            return;
+        }
+        inr::vfsstream os(std::move(f));
+        emit(os, chunk);
+    });
+
+    auto output = [&](std::size_t sizeHint) {
+        return inr::bench::measure([&] {
+            auto out = fs.createOutput(PATH, sizeHint, ec);
+            if(!out) {
+                ok = false;
+                return;
+            }
+            // The stream owns the file, it's committed through a reference.
+            inr::vfs::OutputFile& file = *out;
+            inr::vfsstream os(std::move(out));
+            emit(os, chunk);
+            ok &= !file.commit();
+        });
+    };
+    std::uint64_t unknown = output(0);
+    std::uint64_t reserved = output(SIZE);
+
+    if(!ok || fs.stat(PATH, ec).getSize() != SIZE) return 1;
+    fs.rm(PATH);
+
+    inr::out() << "== " << (SIZE >> 20) << " MiB written in 4 KiB chunks ==\n";
+    inr::bench::reportBytes("  open, truncate in place", truncated, SIZE);
+    inr::bench::reportBytes("  createOutput, no size", unknown, SIZE);
+    inr::bench::reportBytes("  createOutput, preallocated", reserved, SIZE);
+
+    inr::out().flush();
+    return 0;
+}
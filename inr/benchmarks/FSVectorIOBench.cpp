@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+constexpr std::string_view PATH = "FSVectorIOBench.tmp";
+constexpr unsigned OBJECTS = 10000;
+
+/// @brief Pieces of a small object file, written in this order.
+struct Object {
+    std::string header = std::string(64, 'h');
+    std::vector<std::string> sections{std::string(1024, 's'),
+                                      std::string(100, 'd'),
+                                      std::string(256, 'r')};
+    std::string strtab = std::string(200, 't');
+
+    std::size_t size() const {
+        std::size_t res = header.size() + strtab.size();
+        for(const std::string& sec : sections) res += sec.size();
+        return res;
+    }
+};
+
+template<typename Fn>
+static std::uint64_t run(Fn fn) {
+    std::error_code ec;
+    return inr::bench::measure([&] {
+        auto f = inr::vfs::getNativeFs().open(
+            PATH, inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec);
+        if(f) fn(f);
+    });
+}
+
+int main() {
+    Object obj;
+    std::size_t total = obj.size() * OBJECTS;
+
+    // A write per piece.
+    std::uint64_t pieces = run([&](std::unique_ptr<inr::vfs::File>& f) {
+        for(unsigned i = 0; i < OBJECTS; i++) {
+            f->write(obj.header.data(), obj.header.size());
+            for(auto& sec : obj.sections) f->write(sec.data(), sec.size());
+            f->write(obj.strtab.data(), obj.strtab.size());
+        }
+    });
+
+    // Everything copied into one buffer first.
+    std::uint64_t copied = run([&](std::unique_ptr<inr::vfs::File>& f) {
+        std::vector<char> buf(obj.size());
+        for(unsigned i = 0; i < OBJECTS; i++) {
+            char* p = buf.data();
+            std::memcpy(p, obj.header.data(), obj.header.size());
+            p += obj.header.size();
+            for(auto& sec : obj.sections) {
+                std::memcpy(p, sec.data(), sec.size());
+                p += sec.size();
+            }
+            std::memcpy(p, obj.strtab.data(), obj.strtab.size());
+            f->write(buf.data(), buf.size());
+        }
+    });
+
+    // One gather write per object.
+    std::uint64_t gathered = run([&](std::unique_ptr<inr::vfs::File>& f) {
+        for(unsigned i = 0; i < OBJECTS; i++) {
+            inr::vfs::ConstIOVec vecs[] = {
+                {obj.header.data(), obj.header.size()},
+                {obj.sections[0].data(), obj.sections[0].size()},
+                {obj.sections[1].data(), obj.sections[1].size()},
+                {obj.sections[2].data(), obj.sections[2].size()},
+                {obj.strtab.data(), obj.strtab.size()}};
+            f->writev(vecs);
+        }
+    });
+
+    // Through a buffered stream, large pieces are gathered with the buffer.
+    std::uint64_t streamed = run([&](std::unique_ptr<inr::vfs::File>& f) {
+        inr::vfsstream os(std::move(f));
+        for(unsigned i = 0; i < OBJECTS; i++) {
+            os << obj.header;
+            for(auto& sec : obj.sections) os << sec;
+            os << obj.strtab;
+        }
+    });
+
+    std::error_code ec;
+    if(inr::vfs::getNativeFs().stat(PATH, ec).getSize() != total) return 1;
+    inr::vfs::getNativeFs().rm(PATH);
+
+    inr::out() << "== " << OBJECTS << " objects of 5 pieces, " << total
+               << " bytes ==\n";
+    inr::bench::reportBytes("  write per piece", pieces, total);
+    inr::bench::reportBytes("  copy, one write", copied, total);
+    inr::bench::reportBytes("  one writev", gathered, total);
+    inr::bench::reportBytes("  vfsstream", streamed, total);
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+/// @brief Counts the entries, and the regular files among them.
+class Counter : public inr::vfs::DirVisitor {
+public:
+    std::size_t entries = 0;
+    std::size_t files = 0;
+
+    inr::vfs::WalkAction visit(const inr::vfs::DirEntry& entry) override {
+        entries++;
+        files += entry.getFT() == inr::vfs::FileType::Regular;
+        return inr::vfs::WalkAction::Continue;
+    }
+};
+
+int main(int argc, char** argv) {
+    std::string_view root = argc > 1 ? argv[1] : "/usr/include";
+    inr::vfs::Filesystem& fs = inr::vfs::getNativeFs();
+
+    std::error_code ec;
+    Counter walked, listed;
+    std::uint64_t walk = inr::bench::measure([&] {
+        walked = Counter();
+        if(!ec) ec = fs.walk(root, walked);
+    });
+    // The generic walk, listDirs and a stat per entry.
+    std::uint64_t list = inr::bench::measure([&] {
+        listed = Counter();
+        if(!ec) ec = fs.Filesystem::walk(root, listed);
+    });
+    if(ec) {
+        inr::err() << "Walking '" << root << "' failed: " << ec.message()
+                   << '\n';
+        return 1;
+    }
+
+    inr::out() << "== " << root << ", " << walked.entries << " entries, "
+               << walked.files << " files ==\n";
+    inr::bench::report("  walk, readdir types", walk, walked.entries);
+    // Follows symlinks, so it may see more entries.
+    inr::bench::report("  listDirs and stat", list, listed.entries);
+
+    inr::out().flush();
+    return 0;
+}
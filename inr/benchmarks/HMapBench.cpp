@@ -0,0 +1,186 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HMapInfo.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// @brief The byte at a time linear probing map HMap used before group
+/// probing, kept as the baseline.
+template<typename Key, typename Val, typename Info = inr::HMapInfo<Key>>
+class LinearMap {
+    struct Entry {
+        Key key_;
+        Val val_;
+    };
+    enum class State : unsigned char { Empty = 0, Taken, Deleted };
+
+    Entry* entries_ = nullptr;
+    State* states_ = nullptr;
+    std::size_t size_ = 0, capacity_ = 0;
+
+    void allocate(std::size_t capacity) {
+        entries_ = (Entry*)std::malloc((sizeof(Entry) + 1) * capacity);
+        states_ = (State*)(entries_ + capacity);
+        std::memset(states_, 0, capacity);
+        capacity_ = capacity;
+    }
+
+    std::size_t probe(const Key& key) const {
+        std::size_t mask = capacity_ - 1;
+        std::size_t index = Info::hash(key) & mask;
+        while(states_[index] == State::Taken &&
+              !Info::equal(key, entries_[index].key_)) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void rehash() {
+        Entry* oldEntries = entries_;
+        State* oldStates = states_;
+        std::size_t oldCapacity = capacity_;
+
+        allocate(capacity_ << 1);
+        for(std::size_t i = 0; i < oldCapacity; i++) {
+            if(oldStates[i] != State::Taken) continue;
+            std::size_t index = probe(oldEntries[i].key_);
+            std::construct_at(entries_ + index, std::move(oldEntries[i]));
+            states_[index] = State::Taken;
+        }
+        std::free(oldEntries);
+    }
+
+public:
+    LinearMap() {
+        allocate(0x2000);
+    }
+
+    ~LinearMap() {
+        std::free(entries_);
+    }
+
+    void try_emplace(const Key& key, const Val& val) {
+        if(size_ * 4 >= capacity_ * 3) rehash();
+        std::size_t index = probe(key);
+        if(states_[index] == State::Taken) return;
+
+        std::construct_at(entries_ + index, Entry{key, val});
+        states_[index] = State::Taken;
+        size_++;
+    }
+
+    const Val* find(const Key& key) const {
+        std::size_t index = probe(key);
+        return states_[index] == State::Taken ? &entries_[index].val_
+                                              : nullptr;
+    }
+};
+
+/// @brief Adapts std::unordered_map to the same interface.
+template<typename Key, typename Val, typename Info = inr::HMapInfo<Key>>
+class StdMap {
+    struct Hash {
+        std::size_t operator()(const Key& key) const {
+            return Info::hash(key);
+        }
+    };
+    std::unordered_map<Key, Val, Hash> map_;
+
+public:
+    void try_emplace(const Key& key, const Val& val) {
+        map_.try_emplace(key, val);
+    }
+
+    const Val* find(const Key& key) const {
+        auto it = map_.find(key);
+        return it == map_.end() ? nullptr : &it->second;
+    }
+};
+
+/// @brief Inserts every key, then looks up the hits and the misses.
+template<typename Map, typename Key>
+void run(std::string_view name, const std::vector<Key>& keys,
+         const std::vector<Key>& misses) {
+    std::unique_ptr<Map> map;
+
+    std::uint64_t insert = inr::bench::measure([&] {
+        map = std::make_unique<Map>();
+        for(std::size_t i = 0; i < keys.size(); i++) {
+            map->try_emplace(keys[i], unsigned(i));
+        }
+    });
+
+    std::uint64_t hit = inr::bench::measure([&] {
+        std::size_t found = 0;
+        for(const Key& key : keys) found += map->find(key) != nullptr;
+        inr::bench::keep(found);
+    });
+
+    std::uint64_t miss = inr::bench::measure([&] {
+        std::size_t found = 0;
+        for(const Key& key : misses) found += map->find(key) != nullptr;
+        inr::bench::keep(found);
+    });
+
+    inr::out() << name << ":\n";
+    inr::bench::report("  insert", insert, keys.size());
+    inr::bench::report("  find (hit)", hit, keys.size());
+    inr::bench::report("  find (miss)", miss, misses.size());
+}
+
+template<typename Key>
+void runAll(std::string_view name, const std::vector<Key>& keys,
+            const std::vector<Key>& misses) {
+    inr::out() << "== " << name << " (" << keys.size() << " keys) ==\n";
+    run<inr::HMap<Key, unsigned>>("HMap (groups)", keys, misses);
+    run<LinearMap<Key, unsigned>>("linear probing", keys, misses);
+    run<StdMap<Key, unsigned>>("std::unordered_map", keys, misses);
+    inr::out() << '\n';
+}
+
+struct alignas(64) Node {
+    unsigned val;
+};
+
+/// @brief Runs integer and pointer keys with `count` entries.
+void runSize(std::size_t count) {
+    std::vector<std::size_t> ints, intMisses;
+    for(std::size_t i = 0; i < count; i++) {
+        ints.push_back(i * 7);
+        intMisses.push_back(i * 7 + 3);
+    }
+    runAll("integer keys", ints, intMisses);
+
+    // Identity hashed pointers to aligned nodes, like the IR's def maps.
+    std::vector<Node> nodes(count * 2);
+    std::vector<const Node*> ptrs, ptrMisses;
+    for(std::size_t i = 0; i < count; i++) {
+        ptrs.push_back(&nodes[i * 2]);
+        ptrMisses.push_back(&nodes[i * 2 + 1]);
+    }
+    runAll("pointer keys", ptrs, ptrMisses);
+}
+
+} // namespace
+
+int main() {
+    // Fits in the cache, then doesn't.
+    runSize(1 << 12);
+    runSize(1 << 20);
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/BinaryReader.h>
+#include <inr/IR/BinaryWriter.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/Printer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/StrStream.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+#include "RandomIR.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+int main() {
+    inr::TUnit unit("IRBinaryBench");
+    inr::TypeMap tm;
+    inr::bench::RandomIR(unit, tm).addFunctions(2000, 250);
+
+    std::vector<std::uint8_t> data;
+    std::uint64_t write = inr::bench::measure([&] {
+        data.clear();
+        inr::BinaryWriter::write(unit, data);
+    });
+
+    std::size_t textSize = 0;
+    std::uint64_t print = inr::bench::measure([&] {
+        inr::sstream ss;
+        inr::IRPrinter(unit).print(ss);
+        textSize = ss.str().size();
+    });
+
+    bool ok = true;
+    std::size_t eagerBytes = 0;
+    std::uint64_t read = inr::bench::measure([&] {
+        inr::TUnit copy("IRBinaryBench");
+        ok &= inr::BinaryReader::read(copy, tm, data, &inr::err());
+        inr::bench::keep(copy.getNumSlots());
+        eagerBytes = copy.getAllocator().getBytesReserved();
+    });
+
+    // Opens the module, and only reads every 100th body.
+    std::size_t lazyBytes = 0;
+    std::uint64_t lazy = inr::bench::measure([&] {
+        inr::TUnit copy("IRBinaryBench");
+        inr::BinaryReader reader(copy, tm, data, &inr::err());
+        ok &= reader.open();
+        lazyBytes = copy.getAllocator().getBytesReserved();
+        unsigned i = 0;
+        for(inr::FuncDef& fn : copy.getFuncs()) {
+            if(i++ % 100) continue;
+            ok &= fn.materialize();
+            lazyBytes += fn.getAllocator().getBytesReserved();
+        }
+    });
+    if(!ok) return 1;
+
+    inr::out() << "== 2000 functions, " << data.size() << " bytes binary, "
+               << textSize << " bytes text ==\n";
+    inr::bench::reportBytes("  write binary", write, data.size());
+    inr::bench::reportBytes("  read binary", read, data.size());
+    inr::bench::reportBytes("  print text", print, textSize);
+    inr::bench::reportBytes("  open, read 1% of the bodies", lazy,
+                            data.size());
+    inr::out() << "  memory: " << eagerBytes << " bytes read, " << lazyBytes
+               << " bytes opened\n";
+
+    inr::out().flush();
+    return 0;
+}
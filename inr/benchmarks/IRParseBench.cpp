@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/Parser.h>
+#include <inr/IR/Printer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/StrStream.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+#include "RandomIR.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+static std::string print(const inr::TUnit& unit) {
+    inr::sstream ss;
+    inr::IRPrinter(unit).print(ss);
+    return ss.str();
+}
+
+/// @brief Parses 2000 random functions, checking they print back the same.
+static bool run(std::string_view name, bool named) {
+    inr::TypeMap tm;
+    std::string src;
+    {
+        inr::TUnit unit("IRParseBench");
+        inr::bench::RandomIR(unit, tm).addFunctions(2000, 250, named);
+        src = print(unit);
+    }
+
+    bool ok = true;
+    std::uint64_t ns = inr::bench::measure([&] {
+        inr::TUnit unit("IRParseBench");
+        ok &= inr::IRParser::parse(unit, tm, src, &inr::err());
+        inr::bench::keep(unit.getNumSlots());
+    });
+
+    inr::TUnit unit("IRParseBench");
+    ok &= inr::IRParser::parse(unit, tm, src) && print(unit) == src;
+    if(!ok) {
+        inr::err() << name << ": parsed IR doesn't print back the same\n";
+        return false;
+    }
+
+    inr::bench::reportBytes(name, ns, src.size());
+    return true;
+}
+
+int main() {
+    inr::out() << "== 2000 functions of 250 instructions ==\n";
+    if(!run("  parse, numbered values", false)) return 1;
+    if(!run("  parse, named values", true)) return 1;
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+constexpr unsigned FILES = 1000;
+constexpr std::size_t FILE_SIZE = 4096;
+
+static std::string path(unsigned i) {
+    return "MemoryFsBench." + std::to_string(i) + ".tmp";
+}
+
+/// @brief Writes every file through a stream, then reads them back.
+static bool roundTrip(inr::vfs::Filesystem& fs, const std::string& data) {
+    std::error_code ec;
+    for(unsigned i = 0; i < FILES; i++) {
+        auto f = fs.open(
+            path(i), inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC),
+            ec);
+        if(!f) return false;
+        inr::vfsstream os(std::move(f));
+        os << data;
+    }
+
+    std::size_t sum = 0;
+    for(unsigned i = 0; i < FILES; i++) {
+        auto m = fs.map(path(i), inr::vfs::Advice::Sequential, ec);
+        if(!m || m->size() != FILE_SIZE) return false;
+        sum += (unsigned char)m->data()[i % FILE_SIZE];
+    }
+    inr::bench::keep(sum);
+    return true;
+}
+
+int main() {
+    std::string data(FILE_SIZE, 'o');
+    bool ok = true;
+
+    inr::vfs::Filesystem& native = inr::vfs::getNativeFs();
+    std::uint64_t disk =
+        inr::bench::measure([&] { ok &= roundTrip(native, data); });
+    for(unsigned i = 0; i < FILES; i++) native.rm(path(i));
+
+    inr::vfs::MemoryFilesystem mem;
+    std::uint64_t memory =
+        inr::bench::measure([&] { ok &= roundTrip(mem, data); });
+    if(!ok) return 1;
+
+    inr::out() << "== write and read back " << FILES << " files of "
+               << FILE_SIZE << " bytes ==\n";
+    inr::bench::report("  native filesystem", disk, FILES);
+    inr::bench::report("  memory filesystem", memory, FILES);
+
+    inr::out().flush();
+    return 0;
+}
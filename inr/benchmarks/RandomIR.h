@@ -0,0 +1,159 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_BENCHMARKS_RANDOMIR_H
+#define INERTIA_BENCHMARKS_RANDOMIR_H
+
+/// @file RandomIR.h
+/// @brief Fills units with random, but well formed, function bodies.
+
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BlockDef.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/Type.h>
+#include <inr/IR/TypeMap.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inr::bench {
+
+/// @brief Generates functions shaped like compiled loops: an entry block with
+/// stack slots, a loop with phis fed by a later block, and an exit.
+class RandomIR {
+    TUnit& unit_;
+    TypeMap& tm_;
+    std::uint32_t seed_;
+
+    std::uint32_t next(std::uint32_t bound) {
+        seed_ = seed_ * 1664525 + 1013904223;
+        return (seed_ >> 8) % bound;
+    }
+
+    Def* pick(const std::vector<Def*>& vals) {
+        return vals[next(std::uint32_t(vals.size()))];
+    }
+
+    Def* randomConst() {
+        return unit_.createConst(tm_.getI32(), next(1000));
+    }
+
+    InstDef* randomBinary(BlockDef* blk, Def* lhs, Def* rhs) {
+        switch(next(8)) {
+            case 0:
+                return SubInst::createSub(blk, lhs, rhs);
+            case 1:
+                return MulInst::createMul(blk, lhs, rhs);
+            case 2:
+                return AndInst::createAnd(blk, lhs, rhs);
+            case 3:
+                return OrInst::createOr(blk, lhs, rhs);
+            case 4:
+                return XorInst::createXor(blk, lhs, rhs);
+            case 5:
+                return ShlInst::createShl(blk, lhs, rhs);
+            case 6:
+                return LShrInst::createLShr(blk, lhs, rhs);
+            default:
+                return AddInst::createAdd(blk, lhs, rhs);
+        }
+    }
+
+    /// @brief Appends `count` arithmetic instructions on the values.
+    void fill(BlockDef* blk, std::vector<Def*>& vals, unsigned count,
+              Def* slot) {
+        for(unsigned i = 0; i < count; i++) {
+            Def* rhs = next(4) ? pick(vals) : randomConst();
+            switch(next(10)) {
+                case 0:
+                    StoreInst::createStore(tm_, blk, slot, pick(vals));
+                    break;
+                case 1:
+                    vals.push_back(
+                        LoadInst::createLoad(blk, tm_.getI32(), slot));
+                    break;
+                default:
+                    vals.push_back(randomBinary(blk, pick(vals), rhs));
+                    break;
+            }
+        }
+    }
+
+public:
+    RandomIR(TUnit& unit, TypeMap& tm, std::uint32_t seed = 42) :
+        unit_(unit), tm_(tm), seed_(seed) {}
+
+    /// @brief Adds a function with about `size` instructions.
+    /// @param named Gives the instructions names, otherwise they are
+    /// numbered by the printer.
+    FuncDef* addFunction(std::string_view name, unsigned size,
+                         bool named = false) {
+        const IntType* i32 = tm_.getI32();
+        FuncDef* fn = unit_.createFunction(
+            tm_.getFunc(i32, {i32, i32, tm_.getPtr()}, false), name,
+            Linkage::Global, TypeExt::NoExt);
+        fn->getArg(0)->setName("a");
+        fn->getArg(1)->setName("b");
+        fn->getArg(2)->setName("p");
+
+        BlockDef* entry = unit_.createBlock(tm_, fn, "entry");
+        BlockDef* loop = unit_.createBlock(tm_, fn, "loop");
+        BlockDef* body = unit_.createBlock(tm_, fn, "body");
+        BlockDef* exit = unit_.createBlock(tm_, fn, "exit");
+
+        Def* slot = AllocaInst::createAlloca(tm_, entry, i32,
+                                             unit_.createConst(i32, 1));
+        StoreInst::createStore(tm_, entry, slot, fn->getArg(0));
+        JmpInst::createJmp(tm_, entry, loop);
+
+        PhiInst* iv = PhiInst::createPhi(loop, i32, "iv");
+        PhiInst* acc = PhiInst::createPhi(loop, i32, "acc");
+        Def* done = CmpInst::createCmp(tm_, loop, CmpInst::SGreaterEqual, iv,
+                                       fn->getArg(1));
+        JmpInst::createJmpCond(tm_, loop, done, exit, body);
+
+        std::vector<Def*> vals = {iv, acc, fn->getArg(0), fn->getArg(1)};
+        fill(body, vals, size, slot);
+        Def* nextIv = AddInst::createAdd(body, iv, unit_.createConst(i32, 1));
+        Def* nextAcc = XorInst::createXor(body, acc, vals.back());
+        JmpInst::createJmp(tm_, body, loop);
+
+        iv->addIncoming(unit_.createConst(i32, 0), entry);
+        iv->addIncoming(nextIv, body);
+        acc->addIncoming(fn->getArg(0), entry);
+        acc->addIncoming(nextAcc, body);
+
+        RetInst::createRet(tm_, exit, acc);
+
+        if(named) {
+            unsigned n = 0;
+            for(BlockDef& blk : fn->getBlocks()) {
+                for(InstDef& inst : blk.getInstructions()) {
+                    if(inst.getType() != tm_.getVoid() &&
+                       inst.getName().empty()) {
+                        inst.setName("v" + std::to_string(n++));
+                    }
+                }
+            }
+        }
+        return fn;
+    }
+
+    /// @brief Adds `count` functions named `fn0`, `fn1`... of about `size`
+    /// instructions each.
+    void addFunctions(unsigned count, unsigned size, bool named = false) {
+        for(unsigned i = 0; i < count; i++) {
+            addFunction("fn" + std::to_string(i), size, named);
+        }
+    }
+};
+
+} // namespace inr::bench
+
+#endif // INERTIA_BENCHMARKS_RANDOMIR_H
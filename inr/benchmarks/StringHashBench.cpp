@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HMapInfo.h>
+#include <inr/ADT/Hashing.h>
+#include <inr/Support/Stream.h>
+
+#include "Bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// @brief Amount of bytes hashed per measurement, at every length.
+constexpr std::size_t BYTES = 1 << 24;
+
+/// @brief The byte at a time hash HMapInfo<std::string_view> used before.
+std::size_t djb2(std::string_view v) {
+    std::size_t h = 5381;
+    for(char c : v) h = ((h << 5) + h) + c;
+    return h;
+}
+
+std::size_t fast(std::string_view v) {
+    return inr::HMapInfo<std::string_view>::hash(v);
+}
+
+template<auto Hash>
+std::uint64_t time(const std::vector<std::string>& keys) {
+    return inr::bench::measure([&] {
+        std::size_t acc = 0;
+        for(const std::string& k : keys) acc += Hash(k);
+        inr::bench::keep(acc);
+    });
+}
+
+/// @brief Hashes keys of `len` bytes with both hashes, and reports GB/s.
+void runLength(std::size_t len) {
+    std::vector<std::string> keys;
+    std::size_t count = BYTES / len;
+    for(std::size_t i = 0; i < count; i++) {
+        std::string k = "_ZN3inr" + std::to_string(i);
+        k.resize(len, char('a' + i % 26));
+        keys.push_back(std::move(k));
+    }
+
+    std::uint64_t old = time<djb2>(keys);
+    std::uint64_t now = time<fast>(keys);
+
+    auto gbps = [&](std::uint64_t ns) {
+        return std::uint64_t(double(count * len) / double(ns) * 1000);
+    };
+
+    inr::out() << "== " << len << " byte keys ==\n";
+    inr::bench::report("  djb2", old, count);
+    inr::out() << "    " << gbps(old) << " MB/s\n";
+    inr::bench::report("  hashBytes", now, count);
+    inr::out() << "    " << gbps(now) << " MB/s\n";
+}
+
+/// @brief Builds a symbol table, where the hash is a part of every insert.
+void runTable() {
+    std::vector<std::string> names;
+    for(unsigned i = 0; i < 200000; i++) {
+        names.push_back("_ZN3inr9Function" + std::to_string(i) + "EPNS_4TypeE");
+    }
+
+    std::uint64_t ns = inr::bench::measure([&] {
+        inr::HMap<std::string_view, unsigned> map;
+        for(unsigned i = 0; i < names.size(); i++) map.try_emplace(names[i], i);
+        inr::bench::keep(map.size());
+    });
+
+    inr::out() << "== Symbol table ==\n";
+    inr::bench::report("  insert mangled names", ns, names.size());
+}
+
+} // namespace
+
+int main() {
+    // Identifiers, mangled symbols, and whole lines or files.
+    for(std::size_t len : {4, 8, 16, 32, 64, 256, 4096, 1 << 16}) {
+        runLength(len);
+    }
+    runTable();
+
+    inr::out().flush();
+    return 0;
+}
@@ -0,0 +1,237 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_BITOPS_H
+#define INERTIA_ADT_BITOPS_H
+
+/// @file ADT/BitOps.h
+/// @brief Provides the word kernels shared by the bit vectors.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(INERTIA_BITVECTOR_NO_SIMD)
+#if defined(__AVX2__)
+#define INERTIA_BITVECTOR_AVX2 1
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+#define INERTIA_BITVECTOR_SSE2 1
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace inr {
+
+/// @brief Word the bit vectors store their bits in.
+using BitWord = std::uint64_t;
+
+/// @brief Amount of bits in a BitWord.
+constexpr std::size_t BIT_WORD_BITS = sizeof(BitWord) * 8;
+
+/// @brief Returns the amount of words needed for `bits` bits.
+constexpr std::size_t bitWordsFor(std::size_t bits) {
+    return (bits + BIT_WORD_BITS - 1) / BIT_WORD_BITS;
+}
+
+/// @brief Iterates the indices of the set bits in an array of words.
+class SetBitIterator {
+    const BitWord* words_;
+    std::size_t numWords_;
+    std::size_t wordIndex_;
+    BitWord current_;
+
+    void skipEmpty() {
+        while(current_ == 0 && ++wordIndex_ < numWords_) {
+            current_ = words_[wordIndex_];
+        }
+    }
+
+public:
+    /// @brief Creates the end iterator.
+    SetBitIterator() : words_(nullptr), numWords_(0), wordIndex_(0),
+                       current_(0) {}
+
+    SetBitIterator(const BitWord* words, std::size_t numWords) :
+        words_(words), numWords_(numWords), wordIndex_(0),
+        current_(numWords ? words[0] : 0) {
+        skipEmpty();
+    }
+
+    std::size_t operator*() const {
+        return wordIndex_ * BIT_WORD_BITS + std::countr_zero(current_);
+    }
+
+    SetBitIterator& operator++() {
+        current_ &= current_ - 1;
+        skipEmpty();
+        return *this;
+    }
+
+    /// @brief Every exhausted iterator equals the end iterator.
+    bool operator==(const SetBitIterator& other) const {
+        if(current_ == 0 || other.current_ == 0)
+            return current_ == other.current_;
+        return wordIndex_ == other.wordIndex_ && current_ == other.current_;
+    }
+};
+
+/// @brief Range over the set bits of an array of words.
+class SetBitRange {
+    const BitWord* words_;
+    std::size_t numWords_;
+
+public:
+    SetBitRange(const BitWord* words, std::size_t numWords) :
+        words_(words), numWords_(numWords) {}
+
+    SetBitIterator begin() const {
+        return SetBitIterator(words_, numWords_);
+    }
+
+    SetBitIterator end() const {
+        return SetBitIterator();
+    }
+};
+
+namespace internal {
+
+struct BitOr {
+    static BitWord apply(BitWord a, BitWord b) {
+        return a | b;
+    }
+#ifdef INERTIA_BITVECTOR_SSE2
+    static __m128i apply(__m128i a, __m128i b) {
+        return _mm_or_si128(a, b);
+    }
+#endif
+#ifdef INERTIA_BITVECTOR_AVX2
+    static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_or_si256(a, b);
+    }
+#endif
+};
+
+struct BitAnd {
+    static BitWord apply(BitWord a, BitWord b) {
+        return a & b;
+    }
+#ifdef INERTIA_BITVECTOR_SSE2
+    static __m128i apply(__m128i a, __m128i b) {
+        return _mm_and_si128(a, b);
+    }
+#endif
+#ifdef INERTIA_BITVECTOR_AVX2
+    static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_and_si256(a, b);
+    }
+#endif
+};
+
+/// @brief `a & ~b`, the andnot intrinsics negate their first operand.
+struct BitAndNot {
+    static BitWord apply(BitWord a, BitWord b) {
+        return a & ~b;
+    }
+#ifdef INERTIA_BITVECTOR_SSE2
+    static __m128i apply(__m128i a, __m128i b) {
+        return _mm_andnot_si128(b, a);
+    }
+#endif
+#ifdef INERTIA_BITVECTOR_AVX2
+    static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_andnot_si256(b, a);
+    }
+#endif
+};
+
+/// @brief `dst[i] = Op(dst[i], src[i])` one word at a time.
+/// @return Whether any word of `dst` changed.
+template<typename Op>
+bool applyWordsScalar(BitWord* dst, const BitWord* src, std::size_t n) {
+    BitWord changed = 0;
+    for(std::size_t i = 0; i < n; i++) {
+        BitWord old = dst[i];
+        BitWord val = Op::apply(old, src[i]);
+        changed |= val ^ old;
+        dst[i] = val;
+    }
+    return changed != 0;
+}
+
+/// @brief `dst[i] = Op(dst[i], src[i])`, with the widest vectors available.
+/// @return Whether any word of `dst` changed.
+///
+/// Dataflow iterates until nothing changes, so the kernels track that as they
+/// go instead of comparing the vectors afterwards.
+template<typename Op>
+bool applyWords(BitWord* dst, const BitWord* src, std::size_t n) {
+    std::size_t i = 0;
+    bool changed = false;
+
+#ifdef INERTIA_BITVECTOR_AVX2
+    __m256i changed256 = _mm256_setzero_si256();
+    for(; i + 4 <= n; i += 4) {
+        __m256i old = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i val =
+            Op::apply(old, _mm256_loadu_si256((const __m256i*)(src + i)));
+        changed256 = _mm256_or_si256(changed256, _mm256_xor_si256(val, old));
+        _mm256_storeu_si256((__m256i*)(dst + i), val);
+    }
+    changed = !_mm256_testz_si256(changed256, changed256);
+#endif
+
+#ifdef INERTIA_BITVECTOR_SSE2
+    __m128i changed128 = _mm_setzero_si128();
+    for(; i + 2 <= n; i += 2) {
+        __m128i old = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i val =
+            Op::apply(old, _mm_loadu_si128((const __m128i*)(src + i)));
+        changed128 = _mm_or_si128(changed128, _mm_xor_si128(val, old));
+        _mm_storeu_si128((__m128i*)(dst + i), val);
+    }
+    // All bytes equal to zero gives 0xFFFF.
+    changed |= _mm_movemask_epi8(_mm_cmpeq_epi8(
+                   changed128, _mm_setzero_si128())) != 0xFFFF;
+#endif
+
+    return applyWordsScalar<Op>(dst + i, src + i, n - i) || changed;
+}
+
+/// @brief Returns the amount of set bits in the words.
+inline std::size_t countWords(const BitWord* words, std::size_t n) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < n; i++) count += std::popcount(words[i]);
+    return count;
+}
+
+/// @brief Returns whether any bit is set in both `a` and `b`.
+inline bool anyCommonWords(const BitWord* a, const BitWord* b,
+                           std::size_t n) {
+    for(std::size_t i = 0; i < n; i++) {
+        if(a[i] & b[i]) return true;
+    }
+    return false;
+}
+
+/// @brief Returns the first set bit at or after `from`, or `npos`.
+inline std::size_t findWords(const BitWord* words, std::size_t numWords,
+                             std::size_t from, std::size_t npos) {
+    std::size_t index = from / BIT_WORD_BITS;
+    if(index >= numWords) return npos;
+
+    BitWord word = words[index] & (~BitWord(0) << (from % BIT_WORD_BITS));
+    while(word == 0) {
+        if(++index == numWords) return npos;
+        word = words[index];
+    }
+    return index * BIT_WORD_BITS + std::countr_zero(word);
+}
+
+} // namespace internal
+
+} // namespace inr
+
+#endif // INERTIA_ADT_BITOPS_H
@@ -0,0 +1,276 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_BITVECTOR_H
+#define INERTIA_ADT_BITVECTOR_H
+
+/// @file ADT/BitVector.h
+/// @brief Provides a dense, dynamically sized bit vector.
+
+#include <inr/ADT/BitOps.h>
+#include <inr/Support/Assert.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+namespace inr {
+
+/// @brief A dynamically sized set of bits, stored as an array of words.
+///
+/// Meant for dense sets over a known universe, like liveness over the vregs of
+/// a function. The set operations require both vectors to have the same size
+/// and go through the SIMD kernels of ADT/BitOps.h. Bits past `size()` in the
+/// last word are always kept clear, so counting and comparing can work on
+/// whole words.
+class BitVector {
+public:
+    using size_type = std::size_t;
+
+    /// @brief Returned by the find functions when there is no set bit.
+    constexpr static size_type npos = size_type(-1);
+
+private:
+    BitWord* words_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+
+    size_type numWords() const {
+        return bitWordsFor(size_);
+    }
+
+    void clearUnusedBits() {
+        size_type used = size_ % BIT_WORD_BITS;
+        if(used) words_[numWords() - 1] &= (BitWord(1) << used) - 1;
+    }
+
+    void growWords(size_type minWords) {
+        if(minWords <= capacity_) return;
+
+        size_type newCapacity = std::max(minWords, capacity_ * 2);
+        words_ = (BitWord*)std::realloc(words_, newCapacity * sizeof(BitWord));
+        inr_assert(words_, "BitVector growWords(): out of memory");
+        capacity_ = newCapacity;
+    }
+
+    void checkSameSize([[maybe_unused]] const BitVector& other) const {
+        inr_assert(size_ == other.size_,
+                   "BitVector: set operation on vectors of different sizes");
+    }
+
+public:
+    BitVector() = default;
+
+    /// @brief Creates a vector of `size` bits, all set to `value`.
+    explicit BitVector(size_type size, bool value = false) {
+        resize(size, value);
+    }
+
+    BitVector(const BitVector& other) {
+        *this = other;
+    }
+
+    BitVector& operator=(const BitVector& other) {
+        if(this != &other) {
+            growWords(other.numWords());
+            size_ = other.size_;
+            if(size_) {
+                std::memcpy(words_, other.words_, numWords() * sizeof(BitWord));
+            }
+        }
+        return *this;
+    }
+
+    BitVector(BitVector&& other) noexcept :
+        words_(other.words_), size_(other.size_), capacity_(other.capacity_) {
+        other.words_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    BitVector& operator=(BitVector&& other) noexcept {
+        if(this != &other) {
+            std::free(words_);
+            words_ = other.words_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.words_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+        return *this;
+    }
+
+    ~BitVector() {
+        std::free(words_);
+    }
+
+    /// @brief Returns the amount of bits.
+    size_type size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /// @brief Resizes to `size` bits, new bits are set to `value`.
+    void resize(size_type size, bool value = false) {
+        size_type oldWords = numWords();
+        size_type newWords = bitWordsFor(size);
+        growWords(newWords);
+
+        if(newWords > oldWords) {
+            std::memset(words_ + oldWords, value ? 0xFF : 0,
+                        (newWords - oldWords) * sizeof(BitWord));
+        }
+
+        // The bits past the old size in its last word are clear.
+        size_type used = size_ % BIT_WORD_BITS;
+        if(value && used && size > size_) {
+            words_[oldWords - 1] |= ~BitWord(0) << used;
+        }
+
+        size_ = size;
+        clearUnusedBits();
+    }
+
+    /// @brief Sets the size to 0.
+    /// @note Does not free memory.
+    void clear() {
+        size_ = 0;
+    }
+
+    bool test(size_type n) const {
+        inr_assert(n < size_, "BitVector test(): out of bounds");
+        return (words_[n / BIT_WORD_BITS] >> (n % BIT_WORD_BITS)) & 1;
+    }
+
+    bool operator[](size_type n) const {
+        return test(n);
+    }
+
+    BitVector& set(size_type n) {
+        inr_assert(n < size_, "BitVector set(): out of bounds");
+        words_[n / BIT_WORD_BITS] |= BitWord(1) << (n % BIT_WORD_BITS);
+        return *this;
+    }
+
+    BitVector& reset(size_type n) {
+        inr_assert(n < size_, "BitVector reset(): out of bounds");
+        words_[n / BIT_WORD_BITS] &= ~(BitWord(1) << (n % BIT_WORD_BITS));
+        return *this;
+    }
+
+    /// @brief Sets every bit.
+    BitVector& set() {
+        if(size_) std::memset(words_, 0xFF, numWords() * sizeof(BitWord));
+        clearUnusedBits();
+        return *this;
+    }
+
+    /// @brief Clears every bit.
+    BitVector& reset() {
+        if(size_) std::memset(words_, 0, numWords() * sizeof(BitWord));
+        return *this;
+    }
+
+    /// @brief Returns the amount of set bits.
+    size_type count() const {
+        return internal::countWords(words_, numWords());
+    }
+
+    /// @brief Returns whether any bit is set.
+    bool any() const {
+        return internal::findWords(words_, numWords(), 0, npos) != npos;
+    }
+
+    /// @brief Returns whether no bit is set.
+    bool none() const {
+        return !any();
+    }
+
+    /// @brief Returns the first set bit, or npos.
+    size_type find_first() const {
+        return internal::findWords(words_, numWords(), 0, npos);
+    }
+
+    /// @brief Returns the first set bit after `prev`, or npos.
+    size_type find_next(size_type prev) const {
+        return internal::findWords(words_, numWords(), prev + 1, npos);
+    }
+
+    /// @brief Returns a range over the indices of the set bits.
+    SetBitRange set_bits() const {
+        return SetBitRange(words_, numWords());
+    }
+
+    /// @brief Sets the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool unionWith(const BitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitOr>(words_, other.words_,
+                                                     numWords());
+    }
+
+    /// @brief Clears the bits not set in `other`.
+    /// @return Whether any bit changed.
+    bool intersectWith(const BitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitAnd>(words_, other.words_,
+                                                      numWords());
+    }
+
+    /// @brief Clears the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool subtract(const BitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitAndNot>(words_, other.words_,
+                                                         numWords());
+    }
+
+    BitVector& operator|=(const BitVector& other) {
+        unionWith(other);
+        return *this;
+    }
+
+    BitVector& operator&=(const BitVector& other) {
+        intersectWith(other);
+        return *this;
+    }
+
+    BitVector& operator-=(const BitVector& other) {
+        subtract(other);
+        return *this;
+    }
+
+    /// @brief Returns whether any bit is set in both vectors.
+    bool anyCommon(const BitVector& other) const {
+        checkSameSize(other);
+        return internal::anyCommonWords(words_, other.words_, numWords());
+    }
+
+    bool operator==(const BitVector& other) const {
+        if(size_ != other.size_) return false;
+        if(size_ == 0) return true;
+        return std::memcmp(words_, other.words_,
+                           numWords() * sizeof(BitWord)) == 0;
+    }
+
+    /// @brief Returns the words holding the bits.
+    const BitWord* data() const {
+        return words_;
+    }
+
+    /// @brief Returns the words holding the bits.
+    /// @note Bits past `size()` must be left clear.
+    BitWord* data() {
+        return words_;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_BITVECTOR_H
@@ -0,0 +1,272 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_CONCURRENTHMAP_H
+#define INERTIA_ADT_CONCURRENTHMAP_H
+
+/// @file ADT/ConcurrentHMap.h
+/// @brief Provides a hash map that can be shared between threads.
+
+#include <inr/ADT/HMapInfo.h>
+#include <inr/Support/Allocator.h>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace inr {
+
+/// @brief Insert only hash map for interning across threads.
+/// @note Not exception safe.
+///
+/// Keys are spread over `ShardCount` shards by the high bits of their mixed
+/// hash. Every shard is a linear probing table of pointers to nodes, writers
+/// take the shard's lock, readers take no lock at all: they load the table and
+/// its slots with acquire loads and see either the node or nothing.
+///
+/// Entries are never erased or moved, which is what makes this work without
+/// any reclamation scheme. Nodes are allocated from the shard's arena, so the
+/// address of a value stays the same until the map is cleared or destroyed,
+/// and can be handed out to other threads. Tables replaced by growth are kept
+/// until then as well, a reader may still be probing one. They are at most as
+/// big as the live tables together.
+template<typename Key, typename Val, typename Info = HMapInfo<Key>,
+         std::size_t ShardCount = 32>
+class ConcurrentHMap {
+public:
+    static_assert(std::has_single_bit(ShardCount),
+                  "Shard count must be a power of 2");
+
+    using size_type = std::size_t;
+
+    /// @brief Capacity of a shard's first table.
+    constexpr static size_type MIN_ALLOC_SIZE = 0x10;
+
+private:
+    struct Node {
+        size_type hash_;
+        Key key_;
+        Val val_;
+    };
+
+    struct Table {
+        Table* retired_;
+        size_type capacity_;
+        std::atomic<Node*>* slots_;
+    };
+
+    /// @brief Aligned so that shards don't share cache lines.
+    struct alignas(64) Shard {
+        std::mutex lock_;
+        std::atomic<Table*> table_ = nullptr;
+        std::atomic<size_type> size_ = 0;
+        BumpAllocator nodes_;
+    };
+
+    /// @brief Mutable, lock-free lookups still load from the shards.
+    mutable Shard shards_[ShardCount];
+
+    Shard& shardFor(size_type h) const {
+        constexpr unsigned shardBits = std::countr_zero(ShardCount);
+        if constexpr(shardBits == 0) return shards_[0];
+        else return shards_[h >> (sizeof(size_type) * 8 - shardBits)];
+    }
+
+    static Table* newTable(size_type capacity, Table* retired) {
+        void* mem = ::operator new(sizeof(Table) +
+                                   sizeof(std::atomic<Node*>) * capacity);
+        Table* table = new(mem) Table{retired, capacity, nullptr};
+        table->slots_ = (std::atomic<Node*>*)(table + 1);
+        for(size_type i = 0; i < capacity; i++) {
+            new(table->slots_ + i) std::atomic<Node*>(nullptr);
+        }
+        return table;
+    }
+
+    /// @brief Probes `table` for `key`.
+    /// @return The node if found, otherwise nullptr and the empty slot.
+    template<typename LookupKey>
+    static std::pair<Node*, size_type> probe(const Table* table,
+                                             const LookupKey& key,
+                                             size_type h) {
+        size_type mask = table->capacity_ - 1;
+        size_type index = h & mask;
+
+        while(true) {
+            Node* node = table->slots_[index].load(std::memory_order_acquire);
+            if(!node) return {nullptr, index};
+            if(node->hash_ == h && Info::equal(key, node->key_))
+                return {node, index};
+            index = (index + 1) & mask;
+        }
+    }
+
+    /// @brief Publishes a table with twice the capacity.
+    /// @note The shard's lock must be held.
+    static Table* grow(Shard& shard, Table* old) {
+        Table* table = newTable(old->capacity_ << 1, old);
+        size_type mask = table->capacity_ - 1;
+
+        for(size_type i = 0; i < old->capacity_; i++) {
+            Node* node = old->slots_[i].load(std::memory_order_relaxed);
+            if(!node) continue;
+
+            size_type index = node->hash_ & mask;
+            while(table->slots_[index].load(std::memory_order_relaxed)) {
+                index = (index + 1) & mask;
+            }
+            table->slots_[index].store(node, std::memory_order_relaxed);
+        }
+
+        shard.table_.store(table, std::memory_order_release);
+        return table;
+    }
+
+    static void freeShard(Shard& shard) {
+        Table* table = shard.table_.load(std::memory_order_relaxed);
+
+        if constexpr(!std::is_trivially_destructible_v<Node>) {
+            if(table) {
+                for(size_type i = 0; i < table->capacity_; i++) {
+                    Node* node =
+                        table->slots_[i].load(std::memory_order_relaxed);
+                    if(node) std::destroy_at(node);
+                }
+            }
+        }
+
+        while(table) {
+            Table* retired = table->retired_;
+            ::operator delete(table);
+            table = retired;
+        }
+
+        shard.table_.store(nullptr, std::memory_order_relaxed);
+        shard.size_.store(0, std::memory_order_relaxed);
+        shard.nodes_.reset();
+    }
+
+    template<typename LookupKey>
+    Node* findNode(const LookupKey& key) const {
+        size_type h = mixHash(Info::hash(key));
+        Shard& shard = shardFor(h);
+
+        Table* table = shard.table_.load(std::memory_order_acquire);
+        if(!table) return nullptr;
+        return probe(table, key, h).first;
+    }
+
+    template<typename K, typename... Args>
+    std::pair<Val*, bool> emplace(K&& key, Args&&... args) {
+        size_type h = mixHash(Info::hash(key));
+        Shard& shard = shardFor(h);
+
+        // Most interning finds the key already there, try without the lock.
+        Table* table = shard.table_.load(std::memory_order_acquire);
+        if(table) {
+            if(Node* node = probe(table, key, h).first)
+                return {&node->val_, false};
+        }
+
+        std::lock_guard<std::mutex> guard(shard.lock_);
+
+        table = shard.table_.load(std::memory_order_relaxed);
+        size_type size = shard.size_.load(std::memory_order_relaxed);
+        if(!table) {
+            table = newTable(MIN_ALLOC_SIZE, nullptr);
+            shard.table_.store(table, std::memory_order_release);
+        }
+        else if((size + 1) * 4 > table->capacity_ * 3) {
+            table = grow(shard, table);
+        }
+
+        auto [found, index] = probe(table, key, h);
+        if(found) return {&found->val_, false};
+
+        Node* node = shard.nodes_.template allocate<Node>();
+        node->hash_ = h;
+        std::construct_at(&node->key_, std::forward<K>(key));
+        std::construct_at(&node->val_, std::forward<Args>(args)...);
+
+        table->slots_[index].store(node, std::memory_order_release);
+        shard.size_.store(size + 1, std::memory_order_relaxed);
+        return {&node->val_, true};
+    }
+
+public:
+    ConcurrentHMap() = default;
+
+    ConcurrentHMap(const ConcurrentHMap&) = delete;
+    ConcurrentHMap& operator=(const ConcurrentHMap&) = delete;
+
+    ~ConcurrentHMap() {
+        for(Shard& shard : shards_) freeShard(shard);
+    }
+
+    /// @brief Tries to emplace the value with the provided key.
+    /// @note Thread safe.
+    /// @return A pair with the pointer to the value and boolean if emplaced or
+    /// not. The pointer stays valid until the map is cleared or destroyed.
+    template<typename... Args>
+    std::pair<Val*, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @brief Tries to emplace the value and move the key.
+    /// @note Thread safe. Does not move the key if it didn't emplace.
+    /// @return A pair with the pointer to the value and boolean if emplaced or
+    /// not. The pointer stays valid until the map is cleared or destroyed.
+    template<typename... Args>
+    std::pair<Val*, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /// @brief Finds an element with the provided key, without locking.
+    /// @note Thread safe.
+    /// @return Pointer to the value if found, nullptr if not.
+    template<typename LookupKey>
+    Val* find(const LookupKey& key) {
+        Node* node = findNode(key);
+        return node ? &node->val_ : nullptr;
+    }
+
+    /// @brief Finds an element with the provided key, without locking.
+    /// @note Thread safe.
+    /// @return Pointer to the value if found, nullptr if not.
+    template<typename LookupKey>
+    const Val* find(const LookupKey& key) const {
+        Node* node = findNode(key);
+        return node ? &node->val_ : nullptr;
+    }
+
+    /// @brief Returns the amount of entries in the map.
+    /// @note Only exact when no thread is inserting.
+    size_type size() const {
+        size_type size = 0;
+        for(const Shard& shard : shards_) {
+            size += shard.size_.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    /// @brief Returns whether the map has no entries.
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// @brief Destroys every entry and frees all memory.
+    /// @note Not thread safe, invalidates every value pointer.
+    void clear() {
+        for(Shard& shard : shards_) freeShard(shard);
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_CONCURRENTHMAP_H
@@ -8,12 +8,26 @@
 /// @file ADT/HMapInfo.h
 /// @brief Provides an info on how to hash and compare an element in hash ADTs.
 
+#include <inr/ADT/Hashing.h>
+
 #include <cstddef>
+#include <string>
 #include <string_view>
 #include <type_traits>
 
 namespace inr {
 
+/// @brief Spreads the bits of a hash, so both its low and high bits can be used
+/// to pick a slot.
+///
+/// Hash ADTs run every `HMapInfo::hash` result through this, which keeps weak
+/// hashes like the identity pointer one from clustering.
+inline std::size_t mixHash(std::size_t h) {
+    // Odd multiplier, 2^64 / golden ratio.
+    h *= std::size_t(0x9e3779b97f4a7c15ULL);
+    return h ^ (h >> (sizeof(std::size_t) * 4));
+}
+
 /// @brief Provides info on how an element should be hashed and compared.
 template<typename T>
 struct HMapInfo;
@@ -48,11 +62,7 @@ struct HMapInfo<T*> {
 template<>
 struct HMapInfo<std::string_view> {
     static std::size_t hash(std::string_view v) {
-        std::size_t h = 5381;
-        for(char c : v) {
-            h = ((h << 5) + h) + c;
-        }
-        return h;
+        return std::size_t(hashBytes(v.data(), v.size()));
     }
 
     static bool equal(std::string_view lhs, std::string_view rhs) {
@@ -60,6 +70,10 @@ struct HMapInfo<std::string_view> {
     }
 };
 
+/// @brief Hashes like `std::string_view`, so either can look up the other.
+template<>
+struct HMapInfo<std::string> : HMapInfo<std::string_view> {};
+
 } // namespace inr
 
 #endif // INERTIA_ADT_HMAPINFO_H
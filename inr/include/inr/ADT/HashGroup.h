@@ -0,0 +1,154 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_HASHGROUP_H
+#define INERTIA_ADT_HASHGROUP_H
+
+/// @file ADT/HashGroup.h
+/// @brief Provides the control byte groups used by HashTable.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) && !defined(INERTIA_HMAP_NO_SIMD)
+#define INERTIA_HMAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace inr {
+
+/// @brief Control byte of one slot in a hash table.
+///
+/// Full slots store the low 7 bits of their hash (the fingerprint), so the top
+/// bit is clear. Empty and deleted slots have it set, which lets a group find
+/// free slots by only looking at the sign bits.
+enum class Ctrl : std::int8_t {
+    Empty = -128,
+    Deleted = -2,
+};
+
+/// @brief Amount of slots matched at once.
+constexpr std::size_t HASH_GROUP_WIDTH = 16;
+
+/// @brief Bits set for the slots of a group that matched.
+class GroupMask {
+    std::uint32_t mask_;
+
+public:
+    explicit GroupMask(std::uint32_t mask) : mask_(mask) {}
+
+    /// @brief Returns whether any slot matched.
+    explicit operator bool() const {
+        return mask_ != 0;
+    }
+
+    /// @brief Returns the lowest matched slot.
+    /// @note The mask must not be empty.
+    unsigned lowest() const {
+        return std::countr_zero(mask_);
+    }
+
+    /// @brief Iterates the matched slots from the lowest.
+    class iterator {
+        std::uint32_t mask_;
+
+    public:
+        explicit iterator(std::uint32_t mask) : mask_(mask) {}
+
+        unsigned operator*() const {
+            return std::countr_zero(mask_);
+        }
+
+        iterator& operator++() {
+            mask_ &= mask_ - 1;
+            return *this;
+        }
+
+        bool operator==(const iterator&) const = default;
+    };
+
+    iterator begin() const {
+        return iterator(mask_);
+    }
+
+    iterator end() const {
+        return iterator(0);
+    }
+};
+
+/// @brief Group of control bytes matched one byte at a time.
+///
+/// This is the portable fallback, and what the SIMD group is tested against.
+class ScalarGroup {
+    const std::int8_t* ctrl_;
+
+    template<typename Pred>
+    GroupMask matchIf(Pred pred) const {
+        std::uint32_t mask = 0;
+        for(std::size_t i = 0; i < HASH_GROUP_WIDTH; i++) {
+            if(pred(ctrl_[i])) mask |= std::uint32_t(1) << i;
+        }
+        return GroupMask(mask);
+    }
+
+public:
+    explicit ScalarGroup(const std::int8_t* ctrl) : ctrl_(ctrl) {}
+
+    /// @brief Matches the full slots with the fingerprint `h2`.
+    GroupMask match(std::int8_t h2) const {
+        return matchIf([h2](std::int8_t c) { return c == h2; });
+    }
+
+    /// @brief Matches the empty slots.
+    GroupMask matchEmpty() const {
+        return matchIf(
+            [](std::int8_t c) { return c == (std::int8_t)Ctrl::Empty; });
+    }
+
+    /// @brief Matches the empty and deleted slots.
+    GroupMask matchFree() const {
+        return matchIf([](std::int8_t c) { return c < 0; });
+    }
+};
+
+#ifdef INERTIA_HMAP_SSE2
+/// @brief Group of control bytes matched with SSE2 compares.
+/// @note The control bytes must be aligned to the group width.
+class SSE2Group {
+    __m128i ctrl_;
+
+    static GroupMask toMask(__m128i v) {
+        return GroupMask(std::uint32_t(_mm_movemask_epi8(v)));
+    }
+
+public:
+    explicit SSE2Group(const std::int8_t* ctrl) :
+        ctrl_(_mm_load_si128((const __m128i*)ctrl)) {}
+
+    /// @brief Matches the full slots with the fingerprint `h2`.
+    GroupMask match(std::int8_t h2) const {
+        return toMask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+    }
+
+    /// @brief Matches the empty slots.
+    GroupMask matchEmpty() const {
+        return toMask(
+            _mm_cmpeq_epi8(_mm_set1_epi8((char)Ctrl::Empty), ctrl_));
+    }
+
+    /// @brief Matches the empty and deleted slots.
+    GroupMask matchFree() const {
+        return toMask(ctrl_);
+    }
+};
+
+using HashGroup = SSE2Group;
+#else
+using HashGroup = ScalarGroup;
+#endif
+
+} // namespace inr
+
+#endif // INERTIA_ADT_HASHGROUP_H
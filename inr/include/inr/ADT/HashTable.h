@@ -0,0 +1,467 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_HASHTABLE_H
+#define INERTIA_ADT_HASHTABLE_H
+
+/// @file ADT/HashTable.h
+/// @brief Provides the open addressing table HMap and HSet are built on.
+
+#include <inr/ADT/HMapInfo.h>
+#include <inr/ADT/HashGroup.h>
+#include <inr/ADT/Relocate.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifdef INERTIA_HMAP_STATS
+#include <inr/Support/Stream.h>
+#endif
+
+namespace inr {
+
+#ifdef INERTIA_HMAP_STATS
+/// @brief Statistics of one hash table, see `HashTable::getStats()`.
+///
+/// Probe lengths are counted in groups, a lookup that ends in the group the
+/// hash points at has a length of 1. A high average means the hash function
+/// puts many keys on the same groups.
+struct HashStats {
+    std::size_t size = 0;
+    std::size_t capacity = 0;
+    std::size_t tombstones = 0;
+    std::size_t bytes = 0;
+    std::size_t lookups = 0;
+    std::size_t probes = 0;
+    std::size_t maxProbe = 0;
+    std::size_t rehashes = 0;
+
+    /// @brief Returns the average probe length, 0 without lookups.
+    double averageProbe() const {
+        return lookups ? double(probes) / double(lookups) : 0.0;
+    }
+
+    /// @brief Returns the fraction of slots that are tombstones.
+    double tombstoneRatio() const {
+        return capacity ? double(tombstones) / double(capacity) : 0.0;
+    }
+
+    /// @brief Writes the statistics, one per line.
+    void print(stream& os) const {
+        // Hundredths, the stream has no fixed point formatting.
+        auto fixed = [&os](std::size_t centi) -> stream& {
+            return os << centi / 100 << '.' << (centi % 100 < 10 ? "0" : "")
+                      << centi % 100;
+        };
+
+        os << "size: " << size << ", capacity: " << capacity
+           << ", bytes: " << bytes << '\n';
+        os << "tombstones: " << tombstones << " (";
+        fixed(capacity ? tombstones * 10000 / capacity : 0) << "%)\n";
+        os << "lookups: " << lookups << ", average probe: ";
+        fixed(lookups ? probes * 100 / lookups : 0)
+            << ", max probe: " << maxProbe << '\n';
+        os << "rehashes: " << rehashes << '\n';
+    }
+};
+
+/// @brief Counters a hash table keeps when statistics are enabled.
+struct HashCounters {
+    std::size_t lookups = 0;
+    std::size_t probes = 0;
+    std::size_t maxProbe = 0;
+    std::size_t rehashes = 0;
+
+    void lookup(std::size_t length) {
+        lookups++;
+        probes += length;
+        if(length > maxProbe) maxProbe = length;
+    }
+
+    void rehash() {
+        rehashes++;
+    }
+};
+#else
+/// @brief Statistics are compiled out, define `INERTIA_HMAP_STATS` (the CMake
+/// option of the same name) to keep them.
+struct HashCounters {
+    void lookup(std::size_t) {}
+    void rehash() {}
+};
+#endif
+
+/// @brief Open addressing hash table of entries, probed a group at a time.
+/// @note Not exception safe.
+///
+/// This holds the probing, growing and memory management shared by HMap and
+/// HSet, they only decide what an entry is. `KeyOf::get(const Entry&)` should
+/// return the key of an entry, which is then passed to `Info::hash` and
+/// `Info::equal`. Nothing is allocated until the first insertion or
+/// `reserve()`, an empty table only holds a few null members.
+///
+/// Every slot has a control byte holding either a 7 bit fingerprint of its
+/// hash, or that it is empty or deleted (see ADT/HashGroup.h). Lookups check
+/// 16 control bytes at once and only compare keys whose fingerprint matched,
+/// so long probe runs stay cheap. The hash is mixed before use, which keeps
+/// weak hashes like the identity pointer one from clustering. Erasing only
+/// leaves a tombstone when the slot's group is full, see `erase()`.
+template<typename Entry, typename KeyOf, typename Info>
+class HashTable {
+public:
+    static_assert(alignof(Entry) <= alignof(std::max_align_t),
+                  "Alignment must be less or equals to std::max_align_t");
+
+    using size_type = std::size_t;
+
+    /// @brief Capacity of the first allocation.
+    constexpr static size_type MIN_ALLOC_SIZE = HASH_GROUP_WIDTH;
+
+private:
+    /// @brief Control bytes, followed by the entries in the same allocation.
+    std::int8_t* ctrl_ = nullptr;
+    Entry* entries_ = nullptr;
+
+    size_type size_ = 0;
+    size_type deleted_ = 0;
+    size_type capacity_ = 0;
+
+    [[no_unique_address]] mutable HashCounters counters_;
+
+    /// @brief Returns how many slots can be used before growing.
+    constexpr static size_type maxLoad(size_type capacity) {
+        return capacity - capacity / 8;
+    }
+
+    /// @brief Returns the smallest capacity that fits `n` entries.
+    constexpr static size_type capacityFor(size_type n) {
+        size_type capacity = MIN_ALLOC_SIZE;
+        while(maxLoad(capacity) < n) capacity <<= 1;
+        return capacity;
+    }
+
+    template<typename LookupKey>
+    static size_type hashOf(const LookupKey& key) {
+        return mixHash(Info::hash(key));
+    }
+
+    /// @brief Returns the fingerprint stored in the control byte.
+    static std::int8_t h2(size_type h) {
+        return std::int8_t(h & 0x7F);
+    }
+
+    /// @brief Probes groups in triangular steps, which visits every group
+    /// since their amount is a power of 2.
+    class ProbeSeq {
+        size_type mask_;
+        size_type offset_;
+        size_type step_ = 0;
+
+    public:
+        ProbeSeq(size_type h, size_type capacity) :
+            mask_(capacity / HASH_GROUP_WIDTH - 1),
+            offset_((h >> 7) & mask_) {}
+
+        /// @brief Returns how many groups were probed.
+        size_type length() const {
+            return step_ + 1;
+        }
+
+        /// @brief Returns the first slot of the current group.
+        size_type offset() const {
+            return offset_ * HASH_GROUP_WIDTH;
+        }
+
+        void next() {
+            step_++;
+            offset_ = (offset_ + step_) & mask_;
+        }
+    };
+
+    bool isFull(size_type index) const {
+        return ctrl_[index] >= 0;
+    }
+
+    void destroyEntries() {
+        if constexpr(!std::is_trivially_destructible_v<Entry>) {
+            for(size_type i = 0; i < capacity_; i++) {
+                if(isFull(i)) std::destroy_at(entries_ + i);
+            }
+        }
+    }
+
+    void freeTable() {
+        destroyEntries();
+        std::free(ctrl_);
+    }
+
+    void resetCtrl() {
+        std::memset(ctrl_, (int)Ctrl::Empty, capacity_);
+    }
+
+    void allocate(size_type capacity) {
+        // The capacity is a multiple of the group width, and so of the entry
+        // alignment, entries start right after the control bytes.
+        ctrl_ = (std::int8_t*)std::malloc(capacity + sizeof(Entry) * capacity);
+        inr_assert(ctrl_, "HashTable allocate(): out of memory");
+        entries_ = (Entry*)(ctrl_ + capacity);
+        capacity_ = capacity;
+        resetCtrl();
+    }
+
+    /// @brief Moves every entry into a new allocation of `capacity` slots.
+    /// @note Drops all tombstones.
+    void rehash(size_type capacity) {
+        std::int8_t* oldCtrl = ctrl_;
+        Entry* oldEntries = entries_;
+        size_type oldCapacity = capacity_;
+
+        allocate(capacity);
+        deleted_ = 0;
+        counters_.rehash();
+
+        for(size_type i = 0; i < oldCapacity; i++) {
+            if(oldCtrl[i] < 0) continue;
+
+            Entry& oldE = oldEntries[i];
+            size_type h = hashOf(KeyOf::get(oldE));
+            size_type index = findFreeSlot(h);
+
+            relocate(entries_ + index, &oldE, 1);
+            ctrl_[index] = h2(h);
+        }
+
+        std::free(oldCtrl);
+    }
+
+    /// @brief Makes sure there is room for one more entry.
+    ///
+    /// When at least half of the used slots are tombstones, the table is
+    /// rehashed at the same size instead, so insert/erase churn doesn't make
+    /// it grow without bound.
+    void grow() {
+        if(!capacity_) [[unlikely]] {
+            allocate(MIN_ALLOC_SIZE);
+            return;
+        }
+        if(size_ + deleted_ < maxLoad(capacity_)) [[likely]] return;
+
+        if(deleted_ >= size_) rehash(capacity_);
+        else rehash(capacity_ << 1);
+    }
+
+    /// @brief Finds the first empty or deleted slot on the probe sequence.
+    size_type findFreeSlot(size_type h) const {
+        for(ProbeSeq seq(h, capacity_);; seq.next()) {
+            GroupMask free = HashGroup(ctrl_ + seq.offset()).matchFree();
+            if(free) return seq.offset() + free.lowest();
+        }
+    }
+
+    template<typename LookupKey>
+    std::pair<size_type, bool> findEntry(const LookupKey& key,
+                                         size_type h) const {
+        if(!size_) return {0, false};
+
+        for(ProbeSeq seq(h, capacity_);; seq.next()) {
+            HashGroup group(ctrl_ + seq.offset());
+
+            for(unsigned i : group.match(h2(h))) {
+                size_type index = seq.offset() + i;
+                if(Info::equal(key, KeyOf::get(entries_[index]))) {
+                    counters_.lookup(seq.length());
+                    return {index, true};
+                }
+            }
+            if(group.matchEmpty()) {
+                counters_.lookup(seq.length());
+                return {0, false};
+            }
+        }
+    }
+
+public:
+    /// @brief Constructs an empty table, does not allocate.
+    HashTable() = default;
+
+    /// @brief Constructs a table that fits `capacityHint` entries without
+    /// growing.
+    explicit HashTable(size_type capacityHint) {
+        reserve(capacityHint);
+    }
+
+    HashTable(const HashTable&) = delete;
+    HashTable& operator=(const HashTable&) = delete;
+
+    /// @brief Move constructor.
+    HashTable(HashTable&& other) noexcept :
+        ctrl_(other.ctrl_),
+        entries_(other.entries_),
+        size_(other.size_),
+        deleted_(other.deleted_),
+        capacity_(other.capacity_),
+        counters_(other.counters_) {
+        other.ctrl_ = nullptr;
+        other.entries_ = nullptr;
+        other.size_ = other.deleted_ = other.capacity_ = 0;
+    }
+
+    /// @brief Move operator.
+    HashTable& operator=(HashTable&& other) noexcept {
+        if(this != &other) {
+            freeTable();
+            ctrl_ = other.ctrl_;
+            entries_ = other.entries_;
+            size_ = other.size_;
+            deleted_ = other.deleted_;
+            capacity_ = other.capacity_;
+            counters_ = other.counters_;
+
+            other.ctrl_ = nullptr;
+            other.entries_ = nullptr;
+            other.size_ = other.deleted_ = other.capacity_ = 0;
+        }
+        return *this;
+    }
+
+    ~HashTable() {
+        freeTable();
+    }
+
+    /// @brief Destroys every entry.
+    /// @note Does not free memory.
+    void clear() {
+        destroyEntries();
+        if(capacity_) resetCtrl();
+        size_ = deleted_ = 0;
+    }
+
+    /// @brief Makes room for `n` entries, so inserting them won't rehash.
+    void reserve(size_type n) {
+        size_type capacity = capacityFor(n);
+        if(capacity <= capacity_) return;
+
+        if(!capacity_) allocate(capacity);
+        else rehash(capacity);
+    }
+
+    /// @brief Shrinks the table to the smallest capacity that fits its
+    /// entries and drops the tombstones, frees it entirely if it's empty.
+    void shrink_to_fit() {
+        if(!size_) {
+            freeTable();
+            ctrl_ = nullptr;
+            entries_ = nullptr;
+            deleted_ = capacity_ = 0;
+            return;
+        }
+
+        size_type capacity = capacityFor(size_);
+        if(capacity < capacity_ || deleted_) rehash(capacity);
+    }
+
+    /// @brief Inserts an entry with `key` if there is none.
+    ///
+    /// `construct(Entry*)` is only called when inserting, it should construct
+    /// the entry in the uninitialized slot it is passed.
+    /// @return The entry and whether it was inserted.
+    template<typename LookupKey, typename Construct>
+    std::pair<Entry*, bool> insert(const LookupKey& key,
+                                   Construct&& construct) {
+        return insertHashed(key, Info::hash(key),
+                            std::forward<Construct>(construct));
+    }
+
+    /// @brief Same as `insert`, with `hash` being `Info::hash(key)`, for
+    /// callers that need the hash themselves.
+    template<typename LookupKey, typename Construct>
+    std::pair<Entry*, bool> insertHashed(const LookupKey& key, size_type hash,
+                                         Construct&& construct) {
+        size_type h = mixHash(hash);
+        auto [index, found] = findEntry(key, h);
+        if(found) return {entries_ + index, false};
+
+        // Only grown when inserting, a hit never rehashes.
+        grow();
+        index = findFreeSlot(h);
+        construct(entries_ + index);
+        if(ctrl_[index] == (std::int8_t)Ctrl::Deleted) deleted_--;
+        ctrl_[index] = h2(h);
+        size_++;
+        return {entries_ + index, true};
+    }
+
+    /// @brief Returns the entry with `key`, nullptr if there is none.
+    template<typename LookupKey>
+    Entry* find(const LookupKey& key) const {
+        auto [index, found] = findEntry(key, hashOf(key));
+        return found ? entries_ + index : nullptr;
+    }
+
+    /// @brief Destroys the entry with `key`.
+    /// @return True if erased, false if not found.
+    template<typename LookupKey>
+    bool erase(const LookupKey& key) {
+        auto [index, found] = findEntry(key, hashOf(key));
+        if(!found) return false;
+
+        std::destroy_at(entries_ + index);
+        size_--;
+
+        // Lookups only continue past groups without empty slots, and a group
+        // never gets one back once it was full. So if this group still has an
+        // empty slot, no probe has ever gone past it and the slot can simply
+        // become empty, without leaving a tombstone.
+        size_type group = index & ~(HASH_GROUP_WIDTH - 1);
+        if(HashGroup(ctrl_ + group).matchEmpty()) {
+            ctrl_[index] = (std::int8_t)Ctrl::Empty;
+        }
+        else {
+            ctrl_[index] = (std::int8_t)Ctrl::Deleted;
+            deleted_++;
+        }
+        return true;
+    }
+
+    /// @brief Returns the amount of entries in the table.
+    size_type size() const {
+        return size_;
+    }
+
+    /// @brief Returns the amount of slots in the table.
+    size_type capacity() const {
+        return capacity_;
+    }
+
+#ifdef INERTIA_HMAP_STATS
+    /// @brief Returns the statistics gathered since construction.
+    HashStats getStats() const {
+        HashStats stats;
+        stats.size = size_;
+        stats.capacity = capacity_;
+        stats.tombstones = deleted_;
+        stats.bytes = capacity_ * (sizeof(Entry) + 1);
+        stats.lookups = counters_.lookups;
+        stats.probes = counters_.probes;
+        stats.maxProbe = counters_.maxProbe;
+        stats.rehashes = counters_.rehashes;
+        return stats;
+    }
+
+    /// @brief Writes the statistics to `os`.
+    void dumpStats(stream& os) const {
+        getStats().print(os);
+    }
+#endif
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_HASHTABLE_H
@@ -0,0 +1,274 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_HASHING_H
+#define INERTIA_ADT_HASHING_H
+
+/// @file ADT/Hashing.h
+/// @brief Provides the byte hash used for strings.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#if defined(__SSE2__) && !defined(INERTIA_HASH_NO_SIMD)
+#define INERTIA_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace inr {
+
+namespace internal {
+
+/// @brief Mixing constants, the wyhash ones.
+constexpr std::uint64_t HASH_SECRET[4] = {
+    0xa0761d6478bd642fULL,
+    0xe7037ed1a0b428dbULL,
+    0x8ebc6af09c88c6e3ULL,
+    0x589965cc75374cc3ULL,
+};
+
+/// @brief Odd 32-bit prime the stripe accumulators are scrambled with.
+constexpr std::uint64_t HASH_STRIPE_PRIME = 0x9E3779B1U;
+
+constexpr std::uint64_t splitmix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/// @brief Amount of 64-bit lanes in a stripe.
+constexpr std::size_t HASH_STRIPE_LANES = 8;
+
+/// @brief Amount of bytes in a stripe.
+constexpr std::size_t HASH_STRIPE_BYTES = HASH_STRIPE_LANES * 8;
+
+/// @brief Amount of stripes between scrambles.
+constexpr std::size_t HASH_BLOCK_STRIPES = 16;
+
+/// @brief Keys xor'ed into the stripes. Stripe `s` of a block uses the lanes
+/// starting at `s`, and the scramble uses the last ones.
+struct StripeKeys {
+    std::uint64_t keys[HASH_BLOCK_STRIPES + HASH_STRIPE_LANES * 2];
+
+    constexpr StripeKeys() : keys() {
+        for(std::uint64_t i = 0; i < std::size(keys); i++) {
+            keys[i] = splitmix(HASH_SECRET[i % 4] + i);
+        }
+    }
+};
+
+inline constexpr StripeKeys HASH_STRIPE_KEYS{};
+
+/// @brief 64x64 to 128 bit multiply, returns the low and high halves.
+inline void mul128(std::uint64_t& lo, std::uint64_t& hi) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 r = (unsigned __int128)lo * hi;
+    lo = std::uint64_t(r);
+    hi = std::uint64_t(r >> 64);
+#else
+    std::uint64_t aLo = lo & 0xFFFFFFFF, aHi = lo >> 32;
+    std::uint64_t bLo = hi & 0xFFFFFFFF, bHi = hi >> 32;
+    std::uint64_t ll = aLo * bLo, lh = aLo * bHi;
+    std::uint64_t hl = aHi * bLo, hh = aHi * bHi;
+    std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    lo = (ll & 0xFFFFFFFF) | (mid << 32);
+    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/// @brief Multiplies and folds the two halves together.
+inline std::uint64_t mix128(std::uint64_t a, std::uint64_t b) {
+    mul128(a, b);
+    return a ^ b;
+}
+
+inline std::uint64_t read64(const unsigned char* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline std::uint64_t read32(const unsigned char* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+/// @brief wyhash, for keys of any length.
+///
+/// Keys up to 16 bytes are read with two overlapping loads, longer ones 16
+/// bytes per step, and past 48 bytes with three independent multiplies per
+/// step so they can overlap.
+inline std::uint64_t hashShort(const unsigned char* p, std::size_t len,
+                               std::uint64_t seed) {
+    const std::uint64_t* s = HASH_SECRET;
+    seed ^= mix128(seed ^ s[0], s[1]);
+
+    std::uint64_t a, b;
+    if(len <= 16) {
+        if(len >= 4) {
+            std::size_t mid = (len >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + mid);
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - mid);
+        }
+        else if(len > 0) {
+            a = (std::uint64_t(p[0]) << 16) |
+                (std::uint64_t(p[len >> 1]) << 8) | p[len - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        std::size_t i = len;
+        if(i > 48) {
+            std::uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = mix128(read64(p) ^ s[1], read64(p + 8) ^ seed);
+                see1 = mix128(read64(p + 16) ^ s[2], read64(p + 24) ^ see1);
+                see2 = mix128(read64(p + 32) ^ s[3], read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while(i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while(i > 16) {
+            seed = mix128(read64(p) ^ s[1], read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+
+    a ^= s[1];
+    b ^= seed;
+    mul128(a, b);
+    return mix128(a ^ s[0] ^ len, b ^ s[1]);
+}
+
+/// @brief Accumulates one stripe, one lane at a time.
+inline void accumulateScalar(std::uint64_t* acc, const unsigned char* p,
+                             const std::uint64_t* keys) {
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i++) {
+        std::uint64_t data = read64(p + i * 8);
+        std::uint64_t dk = data ^ keys[i];
+        acc[i ^ 1] += data;
+        acc[i] += (dk & 0xFFFFFFFF) * (dk >> 32);
+    }
+}
+
+inline void scrambleScalar(std::uint64_t* acc, const std::uint64_t* keys) {
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i++) {
+        std::uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= keys[i];
+        acc[i] = a * HASH_STRIPE_PRIME;
+    }
+}
+
+#ifdef INERTIA_HASH_SSE2
+/// @brief Same as `accumulateScalar()`, two lanes per vector.
+inline void accumulateSSE2(std::uint64_t* acc, const unsigned char* p,
+                           const std::uint64_t* keys) {
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(acc + i));
+        __m128i data = _mm_loadu_si128((const __m128i*)(p + i * 8));
+        __m128i dk =
+            _mm_xor_si128(data, _mm_loadu_si128((const __m128i*)(keys + i)));
+        // Low halves times high halves, and the data into the other lane.
+        __m128i product =
+            _mm_mul_epu32(dk, _mm_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        a = _mm_add_epi64(a, _mm_add_epi64(product, swapped));
+        _mm_storeu_si128((__m128i*)(acc + i), a);
+    }
+}
+
+inline void scrambleSSE2(std::uint64_t* acc, const std::uint64_t* keys) {
+    const __m128i prime = _mm_set1_epi32(int(HASH_STRIPE_PRIME));
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(acc + i));
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)(keys + i)));
+        // 64 by 32 bit multiply out of two 32 by 32 bit ones.
+        __m128i lo = _mm_mul_epu32(a, prime);
+        __m128i hi = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+        a = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+        _mm_storeu_si128((__m128i*)(acc + i), a);
+    }
+}
+#endif
+
+/// @brief Hashes keys of at least a stripe, with `Accumulate` and `Scramble`.
+///
+/// This is the XXH3 long key loop: every lane multiplies its own 32-bit
+/// halves, which needs no 128-bit products and maps directly onto vector
+/// multiplies. The bytes after the last whole stripe go through `hashShort()`.
+template<auto Accumulate, auto Scramble>
+std::uint64_t hashLongWith(const unsigned char* p, std::size_t len,
+                           std::uint64_t seed) {
+    const std::uint64_t* keys = HASH_STRIPE_KEYS.keys;
+    std::uint64_t acc[HASH_STRIPE_LANES];
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i++) {
+        acc[i] = HASH_SECRET[i % 4] ^ seed;
+    }
+
+    std::size_t stripes = len / HASH_STRIPE_BYTES;
+    for(std::size_t s = 0; s < stripes; s++) {
+        std::size_t inBlock = s % HASH_BLOCK_STRIPES;
+        Accumulate(acc, p + s * HASH_STRIPE_BYTES, keys + inBlock);
+        if(inBlock == HASH_BLOCK_STRIPES - 1) {
+            Scramble(acc, keys + HASH_BLOCK_STRIPES + HASH_STRIPE_LANES);
+        }
+    }
+
+    std::uint64_t h = len * HASH_SECRET[0];
+    for(std::size_t i = 0; i < HASH_STRIPE_LANES; i += 2) {
+        h += mix128(acc[i] ^ keys[i], acc[i + 1] ^ keys[i + 1]);
+    }
+
+    std::size_t done = stripes * HASH_STRIPE_BYTES;
+    return hashShort(p + done, len - done, h);
+}
+
+inline std::uint64_t hashLongScalar(const unsigned char* p, std::size_t len,
+                                    std::uint64_t seed) {
+    return hashLongWith<accumulateScalar, scrambleScalar>(p, len, seed);
+}
+
+inline std::uint64_t hashLong(const unsigned char* p, std::size_t len,
+                              std::uint64_t seed) {
+#ifdef INERTIA_HASH_SSE2
+    return hashLongWith<accumulateSSE2, scrambleSSE2>(p, len, seed);
+#else
+    return hashLongScalar(p, len, seed);
+#endif
+}
+
+} // namespace internal
+
+/// @brief Keys this long or longer take the vectorized path.
+constexpr std::size_t HASH_LONG_KEY = 256;
+
+/// @brief Hashes `len` bytes at `data`.
+///
+/// A wyhash class hash: short keys, like most symbol names, take a handful of
+/// 64-bit multiplies and read 8 to 16 bytes per step. Long keys accumulate 64
+/// byte stripes, with SSE2 when available. Both paths give the same result on
+/// every platform.
+/// @note Not meant for anything that needs to resist attacks.
+inline std::uint64_t hashBytes(const void* data, std::size_t len,
+                               std::uint64_t seed = 0) {
+    const unsigned char* p = (const unsigned char*)data;
+    if(len >= HASH_LONG_KEY) return internal::hashLong(p, len, seed);
+    return internal::hashShort(p, len, seed);
+}
+
+} // namespace inr
+
+#endif // INERTIA_ADT_HASHING_H
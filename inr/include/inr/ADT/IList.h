@@ -8,14 +8,72 @@
 /// @file ADT/IList.h
 /// @brief Provides an intrusive linked list.
 
+#include <inr/Support/Allocator.h>
 #include <inr/Support/Assert.h>
 
 #include <iterator>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace inr {
 
-template<typename>
+/// @brief Default ilist policy, the list doesn't own its nodes.
+///
+/// Clearing or destroying the list only unlinks the nodes, whoever allocated
+/// them frees them (see `ilist::deleteNodes()`).
+struct ilist_no_alloc {
+    constexpr static bool OWNS_NODES = false;
+};
+
+/// @brief Nodes are allocated with new, and deleted one by one when the list
+/// is cleared or destroyed.
+struct ilist_heap_alloc {
+    constexpr static bool OWNS_NODES = true;
+    constexpr static bool FREES_NODES = true;
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        return new T(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void release(T* node) {
+        delete node;
+    }
+};
+
+/// @brief Nodes are allocated from a bump allocator that outlives the list.
+///
+/// Releasing a node only runs its destructor, its memory goes away with the
+/// allocator's slabs. So clearing a list of trivially destructible nodes does
+/// not walk it at all.
+class ilist_arena_alloc {
+    BumpAllocator* alloc_;
+
+public:
+    constexpr static bool OWNS_NODES = true;
+    constexpr static bool FREES_NODES = false;
+
+    ilist_arena_alloc(BumpAllocator& alloc) : alloc_(&alloc) {}
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        return alloc_->create<T>(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void release(T* node) {
+        std::destroy_at(node);
+    }
+
+    /// @brief Returns the allocator the nodes come from.
+    BumpAllocator& getAllocator() const {
+        return *alloc_;
+    }
+};
+
+template<typename T, typename Alloc = ilist_no_alloc>
 class ilist;
 
 /// @brief An intrusive linked list node.
@@ -29,7 +87,8 @@ class ilist_node {
     pointer next_{};
     pointer prev_{};
 
-    friend class ilist<T>;
+    template<typename, typename>
+    friend class ilist;
 
 public:
     ilist_node() = default;
@@ -63,7 +122,8 @@ template<typename ValT, typename NodeT>
 class ilist_iterator {
     NodeT* node_{};
 
-    friend class ilist<std::remove_const_t<ValT>>;
+    template<typename, typename>
+    friend class ilist;
 
 public:
     using iterator_category = std::bidirectional_iterator_tag;
@@ -127,7 +187,12 @@ public:
 /// class Base : public ilist_node<Base> {...};
 /// ```
 /// This linked list is not copyable, but is movable.
-template<typename T>
+///
+/// `Alloc` decides who owns the nodes, see `ilist_no_alloc`,
+/// `ilist_heap_alloc` and `ilist_arena_alloc`. Lists that own their nodes can
+/// create them with `create()`/`emplace_back()`, and release them when cleared
+/// or destroyed. Nodes are still linked in with `push_back()` either way.
+template<typename T, typename Alloc>
 class ilist {
 public:
     using value_type = T;
@@ -144,6 +209,7 @@ public:
 
 protected:
     mutable ilist_node<T> sentinel_;
+    [[no_unique_address]] Alloc alloc_;
 
     void initSentinel() noexcept {
         sentinel_.next_ = (pointer)&sentinel_;
@@ -160,15 +226,35 @@ protected:
         initSentinel();
     }
 
+    /// @brief Releases every node through the policy and empties the list.
+    void releaseAll() noexcept {
+        // Arena memory is dropped by its owner, trivial nodes need nothing.
+        if constexpr(Alloc::FREES_NODES ||
+                     !std::is_trivially_destructible_v<value_type>) {
+            pointer current = sentinel_.next_;
+            while(current != (pointer)&sentinel_) {
+                pointer nextNode = current->next_;
+                alloc_.release(current);
+                current = nextNode;
+            }
+        }
+        initSentinel();
+    }
+
 public:
     ilist() {
         initSentinel();
     }
 
+    /// @brief Creates a list that gets its nodes from `alloc`.
+    explicit ilist(Alloc alloc) : alloc_(std::move(alloc)) {
+        initSentinel();
+    }
+
     ilist(const ilist&) = delete;
     ilist& operator=(const ilist&) = delete;
 
-    ilist(ilist&& other) noexcept {
+    ilist(ilist&& other) noexcept : alloc_(other.alloc_) {
         if(other.empty()) {
             initSentinel();
         }
@@ -182,7 +268,8 @@ public:
     }
     ilist& operator=(ilist&& other) noexcept {
         if(this != &other) {
-            unlinkAll();
+            clear();
+            alloc_ = other.alloc_;
             if(!other.empty()) {
                 sentinel_.next_ = other.sentinel_.next_;
                 sentinel_.prev_ = other.sentinel_.prev_;
@@ -194,14 +281,44 @@ public:
         return *this;
     }
 
-    ~ilist() = default;
+    ~ilist()
+    requires(!Alloc::OWNS_NODES)
+    = default;
+
+    /// @brief Releases the nodes the list owns.
+    ~ilist()
+    requires Alloc::OWNS_NODES
+    {
+        releaseAll();
+    }
 
     bool empty() const {
         return sentinel_.next_ == (const_pointer)&sentinel_;
     }
 
+    /// @brief Empties the list, releasing the nodes if it owns them.
     void clear() {
-        unlinkAll();
+        if constexpr(Alloc::OWNS_NODES) releaseAll();
+        else unlinkAll();
+    }
+
+    /// @brief Returns the allocation policy.
+    const Alloc& getAllocPolicy() const {
+        return alloc_;
+    }
+
+    /// @brief Creates a node owned by this list, without linking it.
+    template<typename... Args>
+    requires Alloc::OWNS_NODES
+    pointer create(Args&&... args) {
+        return alloc_.template create<value_type>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Creates a node owned by this list and links it at the end.
+    template<typename... Args>
+    requires Alloc::OWNS_NODES
+    pointer emplace_back(Args&&... args) {
+        return push_back(create(std::forward<Args>(args)...));
     }
 
     pointer push_front(pointer node) {
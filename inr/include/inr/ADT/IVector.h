@@ -8,11 +8,13 @@
 /// @file ADT/IVector.h
 /// @brief Provides a vector class that can store some elements on stack.
 
+#include <inr/ADT/Relocate.h>
 #include <inr/Support/Assert.h>
 
 #include <algorithm>
 #include <bit>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <initializer_list>
 #include <iterator>
@@ -24,6 +26,10 @@ namespace inr {
 /// @brief A vector class that can hold N elements on the stack before
 /// allocating heap memory.
 /// @note Not exception safe.
+///
+/// Trivially relocatable elements (see ADT/Relocate.h) are moved with memcpy,
+/// and grow in place with realloc once on the heap. The vector itself is not
+/// trivially relocatable, `data_` may point into its own inline storage.
 template<typename T, std::size_t N>
 class ivec {
 public:
@@ -49,10 +55,36 @@ private:
         return data_ != (const_pointer)inlineStorage_;
     }
 
+    /// @brief Elements that can be moved by copying their bytes live in
+    /// malloc'd memory, so growing can use realloc.
+    constexpr static bool USE_REALLOC =
+        is_trivially_relocatable_v<value_type> &&
+        alignof(value_type) <= alignof(std::max_align_t);
+
+    static pointer allocateHeap(size_type capacity) {
+        if constexpr(USE_REALLOC) {
+            return (pointer)std::malloc(capacity * sizeof(value_type));
+        }
+        else {
+            return (pointer)::operator new[](
+                capacity * sizeof(value_type),
+                std::align_val_t(alignof(value_type)));
+        }
+    }
+
+    static void freeHeap(pointer data) {
+        if constexpr(USE_REALLOC) {
+            std::free(data);
+        }
+        else {
+            ::operator delete[](data, std::align_val_t(alignof(value_type)));
+        }
+    }
+
     void freeMemory() {
         clear();
         if(isOnHeap()) {
-            ::operator delete[](data_, std::align_val_t(alignof(value_type)));
+            freeHeap(data_);
             data_ = (pointer)inlineStorage_;
             capacity_ = N;
         }
@@ -65,28 +97,70 @@ private:
 
         size_type newCapacity = std::bit_ceil(
             std::max<size_type>(minCapacity, DEFAULT_GROW_MINIMUM));
-        pointer newData =
-            (pointer)::operator new[](newCapacity * sizeof(value_type),
-                                      std::align_val_t(alignof(value_type)));
 
-        if constexpr(std::is_trivially_copyable_v<value_type>) {
-            std::memcpy(newData, data_, size_ * sizeof(value_type));
-        }
-        else {
-            for(size_type i = 0; i < size_; i++) {
-                new(newData + i) value_type(std::move(data_[i]));
-                data_[i].~value_type();
+        if constexpr(USE_REALLOC) {
+            if(isOnHeap()) {
+                // Opted in as relocatable, moving the bytes is intended.
+                data_ = (pointer)std::realloc((void*)data_,
+                                              newCapacity * sizeof(value_type));
+                inr_assert(data_, "ivec growMemory(): out of memory");
+                capacity_ = newCapacity;
+                return;
             }
         }
 
-        if(isOnHeap()) {
-            ::operator delete[](data_, std::align_val_t(alignof(value_type)));
-        }
+        pointer newData = allocateHeap(newCapacity);
+        relocate(newData, data_, size_);
+
+        if(isOnHeap()) freeHeap(data_);
 
         data_ = newData;
         capacity_ = newCapacity;
     }
 
+    /// @brief Takes the elements of `other`, which must not be this.
+    void takeFrom(ivec& other) {
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+
+        if(other.isOnHeap()) {
+            data_ = other.data_;
+        }
+        else {
+            data_ = (pointer)inlineStorage_;
+            relocate(data_, other.data_, size_);
+        }
+
+        other.data_ = (pointer)other.inlineStorage_;
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    /// @brief Moves `[from, size_)` to start at `to`, over uninitialized or
+    /// already relocated memory.
+    void shift(size_type from, size_type to) {
+        size_type count = size_ - from;
+        if constexpr(is_trivially_relocatable_v<value_type>) {
+            if(count) {
+                std::memmove((void*)(data_ + to), (const void*)(data_ + from),
+                             count * sizeof(value_type));
+            }
+        }
+        else if(to > from) {
+            for(size_type i = count; i > 0; i--) {
+                pointer src = data_ + from + i - 1;
+                new(data_ + to + i - 1) value_type(std::move(*src));
+                src->~value_type();
+            }
+        }
+        else {
+            for(size_type i = 0; i < count; i++) {
+                new(data_ + to + i) value_type(std::move(data_[from + i]));
+                data_[from + i].~value_type();
+            }
+        }
+    }
+
 public:
     /// @brief Creates an empty vector.
     /// @note Does not initialize elements on stack.
@@ -105,27 +179,7 @@ public:
 
     /// @brief Move constructor.
     ivec(ivec&& other) noexcept {
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-
-        if(other.isOnHeap()) {
-            data_ = other.data_;
-        }
-        else {
-            data_ = (pointer)inlineStorage_;
-            if constexpr(std::is_trivially_copyable_v<value_type>) {
-                std::memcpy(data_, other.data_, size_ * sizeof(value_type));
-            }
-            else {
-                for(size_type i = 0; i < size_; i++) {
-                    new(data_ + i) value_type(std::move(other.data_[i]));
-                    other.data_[i].~value_type();
-                }
-            }
-        }
-        other.data_ = (pointer)other.inlineStorage_;
-        other.size_ = 0;
-        other.capacity_ = N;
+        takeFrom(other);
     }
 
     /// @brief Move operator.
@@ -133,29 +187,7 @@ public:
         if(this == &other) return *this;
 
         freeMemory();
-
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-
-        if(other.isOnHeap()) {
-            data_ = other.data_;
-        }
-        else {
-            data_ = (pointer)inlineStorage_;
-            if constexpr(std::is_trivially_copyable_v<value_type>) {
-                std::memcpy(data_, other.data_, size_ * sizeof(value_type));
-            }
-            else {
-                for(size_type i = 0; i < size_; i++) {
-                    new(data_ + i) value_type(std::move(other.data_[i]));
-                    other.data_[i].~value_type();
-                }
-            }
-        }
-
-        other.data_ = (pointer)other.inlineStorage_;
-        other.size_ = 0;
-        other.capacity_ = N;
+        takeFrom(other);
 
         return *this;
     }
@@ -231,11 +263,7 @@ public:
         inr_assert(index <= size_, "ivec emplace(): position is out of range");
 
         growMemory(size_ + 1);
-
-        for(size_type i = size_; i > index; i--) {
-            new(data_ + i) value_type(std::move(data_[i - 1]));
-            data_[i - 1].~value_type();
-        }
+        shift(index, index + 1);
 
         new(data_ + index) value_type(std::forward<Args>(args)...);
         size_++;
@@ -270,17 +298,7 @@ public:
         if(!count) return pos;
 
         growMemory(size_ + count);
-
-        if constexpr(std::is_trivially_copyable_v<value_type>) {
-            std::memmove(data_ + index + count, data_ + index,
-                         (size_ - index) * sizeof(value_type));
-        }
-        else {
-            for(size_type i = size_; i > index; i--) {
-                new(data_ + i + count - 1) value_type(std::move(data_[i - 1]));
-                data_[i - 1].~value_type();
-            }
-        }
+        shift(index, index + count);
 
         size_type i = 0;
         for(auto it = first; it != last; ++it, i++) {
@@ -297,17 +315,8 @@ public:
         if constexpr(!std::is_trivially_destructible_v<value_type>)
             pos->~value_type();
 
-        if constexpr(std::is_trivially_copyable_v<value_type>) {
-            if(pos + 1 != end()) {
-                std::memmove(pos, pos + 1, (end() - pos) * sizeof(value_type));
-            }
-        }
-        else {
-            for(pos++; pos < end(); pos++) {
-                new(pos - 1) value_type(std::move(*pos));
-                pos->~value_type();
-            }
-        }
+        size_type index = pos - data_;
+        shift(index + 1, index);
         size_--;
     }
 
@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_RELOCATE_H
+#define INERTIA_ADT_RELOCATE_H
+
+/// @file ADT/Relocate.h
+/// @brief Provides the trivially relocatable trait and relocation helpers.
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace inr {
+
+/// @brief Whether moving a T to new memory and destroying the old one is the
+/// same as copying its bytes.
+///
+/// Containers use this to move elements with memcpy/realloc when growing.
+/// Trivially copyable types always are, others have to opt in, either with a
+/// specialization next to the type or a member alias
+/// `using is_trivially_relocatable = std::true_type;`. Types that point into
+/// themselves, like ivec with its inline storage, must not.
+template<typename T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template<typename T>
+requires requires { typename T::is_trivially_relocatable; }
+struct is_trivially_relocatable<T> : T::is_trivially_relocatable {};
+
+/// @brief A unique_ptr is a pointer and its deleter.
+template<typename T, typename Deleter>
+struct is_trivially_relocatable<std::unique_ptr<T, Deleter>>
+    : is_trivially_relocatable<Deleter> {};
+
+template<typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/// @brief Moves `n` objects from `src` into the uninitialized `dst` and
+/// destroys the originals.
+/// @note The ranges must not overlap.
+template<typename T>
+void relocate(T* dst, T* src, std::size_t n) {
+    if constexpr(is_trivially_relocatable_v<T>) {
+        if(n) std::memcpy((void*)dst, (const void*)src, n * sizeof(T));
+    }
+    else {
+        for(std::size_t i = 0; i < n; i++) {
+            std::construct_at(dst + i, std::move(src[i]));
+            std::destroy_at(src + i);
+        }
+    }
+}
+
+} // namespace inr
+
+#endif // INERTIA_ADT_RELOCATE_H
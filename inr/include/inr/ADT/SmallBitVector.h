@@ -0,0 +1,255 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_SMALLBITVECTOR_H
+#define INERTIA_ADT_SMALLBITVECTOR_H
+
+/// @file ADT/SmallBitVector.h
+/// @brief Provides a bit vector that stores a few words inline.
+
+#include <inr/ADT/BitOps.h>
+#include <inr/ADT/BitVector.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+namespace inr {
+
+/// @brief A bit vector that holds up to N bits inside of the object before
+/// spilling to a BitVector.
+///
+/// Most blocks and functions are small, so their sets fit in a word or two and
+/// never allocate. Once resized past N bits the vector moves to the BitVector
+/// and stays there until it is destroyed or moved from, just like SmallHMap.
+template<std::size_t N>
+class SmallBitVector {
+public:
+    static_assert(N > 0, "SmallBitVector needs at least one inline bit");
+
+    using size_type = std::size_t;
+
+    constexpr static size_type npos = BitVector::npos;
+
+private:
+    constexpr static size_type INLINE_WORDS = bitWordsFor(N);
+
+    BitWord inline_[INLINE_WORDS] = {};
+    size_type inlineSize_ = 0;
+    bool spilled_ = false;
+    BitVector vec_;
+
+    BitWord* words() {
+        return spilled_ ? vec_.data() : inline_;
+    }
+
+    const BitWord* words() const {
+        return spilled_ ? vec_.data() : inline_;
+    }
+
+    size_type numWords() const {
+        return bitWordsFor(size());
+    }
+
+    void checkSameSize([[maybe_unused]] const SmallBitVector& other) const {
+        inr_assert(size() == other.size(),
+                   "SmallBitVector: set operation on vectors of different "
+                   "sizes");
+    }
+
+    /// @brief Moves the inline bits into the BitVector.
+    void spill() {
+        vec_.resize(inlineSize_);
+        if(inlineSize_) {
+            std::memcpy(vec_.data(), inline_,
+                        bitWordsFor(inlineSize_) * sizeof(BitWord));
+        }
+        spilled_ = true;
+    }
+
+public:
+    SmallBitVector() = default;
+
+    /// @brief Creates a vector of `size` bits, all set to `value`.
+    explicit SmallBitVector(size_type size, bool value = false) {
+        resize(size, value);
+    }
+
+    SmallBitVector(const SmallBitVector&) = default;
+    SmallBitVector& operator=(const SmallBitVector&) = default;
+
+    SmallBitVector(SmallBitVector&& other) noexcept :
+        inlineSize_(other.inlineSize_), spilled_(other.spilled_),
+        vec_(std::move(other.vec_)) {
+        std::memcpy(inline_, other.inline_, sizeof(inline_));
+        other.inlineSize_ = 0;
+        other.spilled_ = false;
+    }
+
+    SmallBitVector& operator=(SmallBitVector&& other) noexcept {
+        if(this != &other) {
+            std::memcpy(inline_, other.inline_, sizeof(inline_));
+            inlineSize_ = other.inlineSize_;
+            spilled_ = other.spilled_;
+            vec_ = std::move(other.vec_);
+            other.inlineSize_ = 0;
+            other.spilled_ = false;
+        }
+        return *this;
+    }
+
+    ~SmallBitVector() = default;
+
+    /// @brief Returns the amount of bits.
+    size_type size() const {
+        return spilled_ ? vec_.size() : inlineSize_;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// @brief Returns whether the bits are still stored inline.
+    bool isSmall() const {
+        return !spilled_;
+    }
+
+    /// @brief Resizes to `size` bits, new bits are set to `value`.
+    void resize(size_type size, bool value = false) {
+        if(!spilled_ && size > N) spill();
+        if(spilled_) {
+            vec_.resize(size, value);
+            return;
+        }
+
+        if(value && size > inlineSize_) {
+            for(size_type i = inlineSize_; i < size; i++) {
+                inline_[i / BIT_WORD_BITS] |= BitWord(1) << (i % BIT_WORD_BITS);
+            }
+        }
+        else if(size < inlineSize_) {
+            // Keep the bits past the size clear.
+            for(size_type i = size; i < inlineSize_; i++) {
+                inline_[i / BIT_WORD_BITS] &=
+                    ~(BitWord(1) << (i % BIT_WORD_BITS));
+            }
+        }
+        inlineSize_ = size;
+    }
+
+    bool test(size_type n) const {
+        inr_assert(n < size(), "SmallBitVector test(): out of bounds");
+        return (words()[n / BIT_WORD_BITS] >> (n % BIT_WORD_BITS)) & 1;
+    }
+
+    bool operator[](size_type n) const {
+        return test(n);
+    }
+
+    SmallBitVector& set(size_type n) {
+        inr_assert(n < size(), "SmallBitVector set(): out of bounds");
+        words()[n / BIT_WORD_BITS] |= BitWord(1) << (n % BIT_WORD_BITS);
+        return *this;
+    }
+
+    SmallBitVector& reset(size_type n) {
+        inr_assert(n < size(), "SmallBitVector reset(): out of bounds");
+        words()[n / BIT_WORD_BITS] &= ~(BitWord(1) << (n % BIT_WORD_BITS));
+        return *this;
+    }
+
+    /// @brief Clears every bit.
+    SmallBitVector& reset() {
+        if(spilled_) vec_.reset();
+        else std::memset(inline_, 0, sizeof(inline_));
+        return *this;
+    }
+
+    /// @brief Returns the amount of set bits.
+    size_type count() const {
+        return internal::countWords(words(), numWords());
+    }
+
+    /// @brief Returns whether any bit is set.
+    bool any() const {
+        return find_first() != npos;
+    }
+
+    /// @brief Returns whether no bit is set.
+    bool none() const {
+        return !any();
+    }
+
+    /// @brief Returns the first set bit, or npos.
+    size_type find_first() const {
+        return internal::findWords(words(), numWords(), 0, npos);
+    }
+
+    /// @brief Returns the first set bit after `prev`, or npos.
+    size_type find_next(size_type prev) const {
+        return internal::findWords(words(), numWords(), prev + 1, npos);
+    }
+
+    /// @brief Returns a range over the indices of the set bits.
+    SetBitRange set_bits() const {
+        return SetBitRange(words(), numWords());
+    }
+
+    /// @brief Sets the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool unionWith(const SmallBitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitOr>(words(), other.words(),
+                                                     numWords());
+    }
+
+    /// @brief Clears the bits not set in `other`.
+    /// @return Whether any bit changed.
+    bool intersectWith(const SmallBitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitAnd>(words(), other.words(),
+                                                      numWords());
+    }
+
+    /// @brief Clears the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool subtract(const SmallBitVector& other) {
+        checkSameSize(other);
+        return internal::applyWords<internal::BitAndNot>(
+            words(), other.words(), numWords());
+    }
+
+    SmallBitVector& operator|=(const SmallBitVector& other) {
+        unionWith(other);
+        return *this;
+    }
+
+    SmallBitVector& operator&=(const SmallBitVector& other) {
+        intersectWith(other);
+        return *this;
+    }
+
+    SmallBitVector& operator-=(const SmallBitVector& other) {
+        subtract(other);
+        return *this;
+    }
+
+    /// @brief Returns whether any bit is set in both vectors.
+    bool anyCommon(const SmallBitVector& other) const {
+        checkSameSize(other);
+        return internal::anyCommonWords(words(), other.words(), numWords());
+    }
+
+    bool operator==(const SmallBitVector& other) const {
+        if(size() != other.size()) return false;
+        if(empty()) return true;
+        return std::memcmp(words(), other.words(),
+                           numWords() * sizeof(BitWord)) == 0;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_SMALLBITVECTOR_H
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_SMALLHMAP_H
+#define INERTIA_ADT_SMALLHMAP_H
+
+/// @file ADT/SmallHMap.h
+/// @brief Provides a hash map that stores a few entries inline.
+
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HMapInfo.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace inr {
+
+/// @brief A map that holds up to N entries inside of the object before
+/// spilling to an HMap.
+/// @note Not exception safe.
+///
+/// While small, lookups are a linear search using `Info::equal`, nothing is
+/// hashed or allocated. Once the N + 1-th entry is inserted every entry is
+/// moved into the HMap, and the map stays there until it is destroyed or
+/// moved from, so `clear()` keeps the table memory just like HMap does.
+/// @note Inserting while small never moves entries, but spilling and erasing
+/// do, so pointers to values are invalidated by both.
+template<typename Key, typename Val, std::size_t N,
+         typename Info = HMapInfo<Key>>
+class SmallHMap {
+public:
+    static_assert(N > 0, "SmallHMap needs at least one inline entry");
+
+    using size_type = std::size_t;
+
+private:
+    struct Entry {
+        Key key_;
+        Val val_;
+    };
+
+    alignas(Entry) std::byte inlineStorage_[N * sizeof(Entry)];
+    size_type inlineSize_ = 0;
+    bool spilled_ = false;
+    HMap<Key, Val, Info> map_;
+
+    Entry* inlineEntries() {
+        return (Entry*)inlineStorage_;
+    }
+
+    const Entry* inlineEntries() const {
+        return (const Entry*)inlineStorage_;
+    }
+
+    template<typename LookupKey>
+    Entry* findInline(const LookupKey& key) const {
+        Entry* entries = (Entry*)inlineStorage_;
+        for(size_type i = 0; i < inlineSize_; i++) {
+            if(Info::equal(key, entries[i].key_)) return entries + i;
+        }
+        return nullptr;
+    }
+
+    void destroyInline() {
+        std::destroy_n(inlineEntries(), inlineSize_);
+        inlineSize_ = 0;
+    }
+
+    void moveFrom(SmallHMap& other) {
+        spilled_ = other.spilled_;
+        map_ = std::move(other.map_);
+
+        Entry* src = other.inlineEntries();
+        for(size_type i = 0; i < other.inlineSize_; i++) {
+            std::construct_at(inlineEntries() + i, std::move(src[i]));
+        }
+        inlineSize_ = other.inlineSize_;
+
+        other.destroyInline();
+        other.spilled_ = false;
+    }
+
+    /// @brief Moves every inline entry into the map.
+    void spill() {
+        map_.reserve(N * 2);
+
+        Entry* entries = inlineEntries();
+        for(size_type i = 0; i < inlineSize_; i++) {
+            map_.try_emplace(std::move(entries[i].key_),
+                             std::move(entries[i].val_));
+        }
+
+        destroyInline();
+        spilled_ = true;
+    }
+
+    template<typename K, typename... Args>
+    std::pair<Val*, bool> emplace(K&& key, Args&&... args) {
+        if(spilled_) {
+            return map_.try_emplace(std::forward<K>(key),
+                                    std::forward<Args>(args)...);
+        }
+
+        if(Entry* e = findInline(key)) return {&e->val_, false};
+
+        if(inlineSize_ == N) {
+            spill();
+            return map_.try_emplace(std::forward<K>(key),
+                                    std::forward<Args>(args)...);
+        }
+
+        Entry* e = inlineEntries() + inlineSize_;
+        std::construct_at(&e->key_, std::forward<K>(key));
+        std::construct_at(&e->val_, std::forward<Args>(args)...);
+        inlineSize_++;
+        return {&e->val_, true};
+    }
+
+public:
+    SmallHMap() = default;
+
+    SmallHMap(const SmallHMap&) = delete;
+    SmallHMap& operator=(const SmallHMap&) = delete;
+
+    /// @brief Move constructor.
+    SmallHMap(SmallHMap&& other) noexcept {
+        moveFrom(other);
+    }
+
+    /// @brief Move operator.
+    SmallHMap& operator=(SmallHMap&& other) noexcept {
+        if(this != &other) {
+            destroyInline();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallHMap() {
+        destroyInline();
+    }
+
+    /// @brief Resets the amount of elements.
+    /// @note Does not free memory.
+    void clear() {
+        destroyInline();
+        map_.clear();
+    }
+
+    /// @brief Tries to emplace the value with the provided key.
+    /// @return A pair with the pointer to the value and boolean if emplaced or
+    /// not.
+    template<typename... Args>
+    std::pair<Val*, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @brief Tries to emplace the value and move the key.
+    /// @note Does not move the key if it didn't emplace.
+    /// @return A pair with the pointer to the value and boolean if emplaced or
+    /// not.
+    template<typename... Args>
+    std::pair<Val*, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /// @brief Finds an element with the provided key.
+    /// @return Pointer to the value if found, nullptr if not.
+    Val* find(const Key& key) {
+        if(spilled_) return map_.find(key);
+        Entry* e = findInline(key);
+        return e ? &e->val_ : nullptr;
+    }
+
+    /// @brief Finds an element with the provided key.
+    /// @return Pointer to the value if found, nullptr if not.
+    const Val* find(const Key& key) const {
+        if(spilled_) return map_.find(key);
+        const Entry* e = findInline(key);
+        return e ? &e->val_ : nullptr;
+    }
+
+    /// @brief Tries to erase an element at the provided key.
+    /// @note While small, the last entry is moved into the erased one's place.
+    /// @return True if erased, false if not found.
+    bool erase(const Key& key) {
+        if(spilled_) return map_.erase(key);
+
+        Entry* e = findInline(key);
+        if(!e) return false;
+
+        Entry* last = inlineEntries() + inlineSize_ - 1;
+        if(e != last) {
+            std::destroy_at(e);
+            std::construct_at(e, std::move(*last));
+        }
+        std::destroy_at(last);
+        inlineSize_--;
+        return true;
+    }
+
+    /// @brief Returns the amount of entries in the map.
+    size_type size() const {
+        return spilled_ ? map_.size() : inlineSize_;
+    }
+
+    /// @brief Returns whether the map has no entries.
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// @brief Returns whether the entries are still stored inline.
+    bool isSmall() const {
+        return !spilled_;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_SMALLHMAP_H
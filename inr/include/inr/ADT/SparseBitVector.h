@@ -0,0 +1,334 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_SPARSEBITVECTOR_H
+#define INERTIA_ADT_SPARSEBITVECTOR_H
+
+/// @file ADT/SparseBitVector.h
+/// @brief Provides a bit vector for very sparse sets.
+
+#include <inr/ADT/BitOps.h>
+#include <inr/ADT/IVector.h>
+
+#include <bit>
+#include <cstddef>
+
+namespace inr {
+
+/// @brief A set of bits over an unbounded universe, storing only the chunks
+/// that have bits set.
+///
+/// Chunks of `ELEMENT_BITS` bits are kept in a vector sorted by their index,
+/// so the set operations are a merge of two sorted arrays, and memory is
+/// proportional to the amount of distinct chunks instead of the largest bit.
+/// Meant for things like the vregs live across a call, where a handful of bits
+/// are set out of many thousands.
+class SparseBitVector {
+public:
+    using size_type = std::size_t;
+
+    /// @brief Amount of words in one element.
+    constexpr static size_type ELEMENT_WORDS = 2;
+
+    /// @brief Amount of bits in one element.
+    constexpr static size_type ELEMENT_BITS = ELEMENT_WORDS * BIT_WORD_BITS;
+
+    /// @brief Returned by `find_first()` when there is no set bit.
+    constexpr static size_type npos = size_type(-1);
+
+private:
+    struct Element {
+        size_type index_;
+        BitWord words_[ELEMENT_WORDS];
+
+        bool empty() const {
+            for(BitWord w : words_) {
+                if(w) return false;
+            }
+            return true;
+        }
+    };
+
+    ivec<Element, 1> elements_;
+
+    /// @brief Returns the first element with an index not less than `index`.
+    Element* lowerBound(size_type index) {
+        Element* first = elements_.begin();
+        size_type count = elements_.size();
+        while(count) {
+            size_type half = count / 2;
+            if(first[half].index_ < index) {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else {
+                count = half;
+            }
+        }
+        return first;
+    }
+
+    const Element* lowerBound(size_type index) const {
+        return const_cast<SparseBitVector*>(this)->lowerBound(index);
+    }
+
+    /// @brief Applies `Op` to the elements both vectors have.
+    /// @return Whether any bit changed.
+    template<typename Op>
+    bool applyCommon(const SparseBitVector& other) {
+        bool changed = false;
+        const Element* src = other.elements_.begin();
+        const Element* srcEnd = other.elements_.end();
+
+        size_type out = 0;
+        for(size_type i = 0; i < elements_.size(); i++) {
+            Element& e = elements_[i];
+            while(src != srcEnd && src->index_ < e.index_) src++;
+
+            BitWord zero[ELEMENT_WORDS] = {};
+            const BitWord* with =
+                (src != srcEnd && src->index_ == e.index_) ? src->words_ : zero;
+            changed |=
+                internal::applyWordsScalar<Op>(e.words_, with, ELEMENT_WORDS);
+
+            if(!e.empty()) elements_[out++] = e;
+        }
+
+        while(elements_.size() > out) elements_.pop_back();
+        return changed;
+    }
+
+public:
+    SparseBitVector() = default;
+
+    SparseBitVector(const SparseBitVector&) = default;
+    SparseBitVector& operator=(const SparseBitVector&) = default;
+
+    SparseBitVector(SparseBitVector&&) noexcept = default;
+    SparseBitVector& operator=(SparseBitVector&&) noexcept = default;
+
+    ~SparseBitVector() = default;
+
+    bool test(size_type n) const {
+        const Element* e = lowerBound(n / ELEMENT_BITS);
+        if(e == elements_.end() || e->index_ != n / ELEMENT_BITS) return false;
+        size_type bit = n % ELEMENT_BITS;
+        return (e->words_[bit / BIT_WORD_BITS] >> (bit % BIT_WORD_BITS)) & 1;
+    }
+
+    /// @brief Sets bit `n`.
+    /// @return Whether it was clear before.
+    bool set(size_type n) {
+        size_type index = n / ELEMENT_BITS;
+        Element* e = lowerBound(index);
+        if(e == elements_.end() || e->index_ != index) {
+            e = elements_.insert(e, Element{index, {}});
+        }
+
+        size_type bit = n % ELEMENT_BITS;
+        BitWord mask = BitWord(1) << (bit % BIT_WORD_BITS);
+        BitWord& word = e->words_[bit / BIT_WORD_BITS];
+        bool wasClear = !(word & mask);
+        word |= mask;
+        return wasClear;
+    }
+
+    /// @brief Clears bit `n`.
+    /// @return Whether it was set before.
+    bool reset(size_type n) {
+        size_type index = n / ELEMENT_BITS;
+        Element* e = lowerBound(index);
+        if(e == elements_.end() || e->index_ != index) return false;
+
+        size_type bit = n % ELEMENT_BITS;
+        BitWord mask = BitWord(1) << (bit % BIT_WORD_BITS);
+        BitWord& word = e->words_[bit / BIT_WORD_BITS];
+        bool wasSet = word & mask;
+        word &= ~mask;
+        if(e->empty()) elements_.erase(e);
+        return wasSet;
+    }
+
+    /// @brief Clears every bit and frees nothing.
+    void clear() {
+        elements_.clear();
+    }
+
+    /// @brief Returns whether no bit is set.
+    bool empty() const {
+        return elements_.empty();
+    }
+
+    /// @brief Returns the amount of set bits.
+    size_type count() const {
+        size_type count = 0;
+        for(const Element& e : elements_) {
+            count += internal::countWords(e.words_, ELEMENT_WORDS);
+        }
+        return count;
+    }
+
+    /// @brief Returns the first set bit, or npos.
+    size_type find_first() const {
+        if(elements_.empty()) return npos;
+        const Element& e = elements_.front();
+        return e.index_ * ELEMENT_BITS +
+               internal::findWords(e.words_, ELEMENT_WORDS, 0, npos);
+    }
+
+    /// @brief Sets the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool unionWith(const SparseBitVector& other) {
+        if(other.elements_.empty()) return false;
+
+        // Merge from the back so no element is moved twice.
+        size_type ours = elements_.size();
+        size_type theirs = other.elements_.size();
+        size_type extra = 0;
+        for(size_type i = 0, j = 0; j < theirs; j++) {
+            while(i < ours && elements_[i].index_ < other.elements_[j].index_)
+                i++;
+            if(i == ours || elements_[i].index_ != other.elements_[j].index_)
+                extra++;
+        }
+
+        bool changed = extra != 0;
+        for(size_type i = 0; i < extra; i++) elements_.push_back(Element{});
+
+        size_type out = ours + extra;
+        size_type i = ours;
+        size_type j = theirs;
+        while(j > 0) {
+            const Element& src = other.elements_[j - 1];
+            if(i > 0 && elements_[i - 1].index_ > src.index_) {
+                elements_[--out] = elements_[--i];
+            }
+            else if(i > 0 && elements_[i - 1].index_ == src.index_) {
+                Element e = elements_[--i];
+                changed |= internal::applyWordsScalar<internal::BitOr>(
+                    e.words_, src.words_, ELEMENT_WORDS);
+                elements_[--out] = e;
+                j--;
+            }
+            else {
+                elements_[--out] = src;
+                j--;
+            }
+        }
+        return changed;
+    }
+
+    /// @brief Clears the bits not set in `other`.
+    /// @return Whether any bit changed.
+    bool intersectWith(const SparseBitVector& other) {
+        return applyCommon<internal::BitAnd>(other);
+    }
+
+    /// @brief Clears the bits set in `other`.
+    /// @return Whether any bit changed.
+    bool subtract(const SparseBitVector& other) {
+        return applyCommon<internal::BitAndNot>(other);
+    }
+
+    SparseBitVector& operator|=(const SparseBitVector& other) {
+        unionWith(other);
+        return *this;
+    }
+
+    SparseBitVector& operator&=(const SparseBitVector& other) {
+        intersectWith(other);
+        return *this;
+    }
+
+    SparseBitVector& operator-=(const SparseBitVector& other) {
+        subtract(other);
+        return *this;
+    }
+
+    /// @brief Returns whether any bit is set in both vectors.
+    bool anyCommon(const SparseBitVector& other) const {
+        const Element* a = elements_.begin();
+        const Element* b = other.elements_.begin();
+        while(a != elements_.end() && b != other.elements_.end()) {
+            if(a->index_ < b->index_) a++;
+            else if(b->index_ < a->index_) b++;
+            else {
+                if(internal::anyCommonWords(a->words_, b->words_,
+                                            ELEMENT_WORDS))
+                    return true;
+                a++;
+                b++;
+            }
+        }
+        return false;
+    }
+
+    bool operator==(const SparseBitVector& other) const {
+        if(elements_.size() != other.elements_.size()) return false;
+        for(size_type i = 0; i < elements_.size(); i++) {
+            const Element& a = elements_[i];
+            const Element& b = other.elements_[i];
+            if(a.index_ != b.index_) return false;
+            for(size_type w = 0; w < ELEMENT_WORDS; w++) {
+                if(a.words_[w] != b.words_[w]) return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Iterates the indices of the set bits in increasing order.
+    class iterator {
+        const Element* element_;
+        const Element* end_;
+        size_type word_ = 0;
+        BitWord current_ = 0;
+
+        void skipEmpty() {
+            while(current_ == 0) {
+                if(++word_ == ELEMENT_WORDS) {
+                    word_ = 0;
+                    if(++element_ == end_) return;
+                }
+                current_ = element_->words_[word_];
+            }
+        }
+
+    public:
+        iterator(const Element* element, const Element* end) :
+            element_(element), end_(end) {
+            if(element_ != end_) {
+                current_ = element_->words_[0];
+                skipEmpty();
+            }
+        }
+
+        size_type operator*() const {
+            return element_->index_ * ELEMENT_BITS + word_ * BIT_WORD_BITS +
+                   std::countr_zero(current_);
+        }
+
+        iterator& operator++() {
+            current_ &= current_ - 1;
+            skipEmpty();
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const {
+            return element_ == other.element_ && word_ == other.word_ &&
+                   current_ == other.current_;
+        }
+    };
+
+    iterator begin() const {
+        return iterator(elements_.begin(), elements_.end());
+    }
+
+    iterator end() const {
+        return iterator(elements_.end(), elements_.end());
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_SPARSEBITVECTOR_H
@@ -0,0 +1,180 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_ADT_STRINGPOOL_H
+#define INERTIA_ADT_STRINGPOOL_H
+
+/// @file ADT/StringPool.h
+/// @brief Provides a pool of interned strings.
+
+#include <inr/ADT/HMapInfo.h>
+#include <inr/ADT/HSet.h>
+#include <inr/Support/Allocator.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+
+namespace inr {
+
+/// @brief Handle to a string interned by a StringPool.
+///
+/// Equal strings from the same pool share the same handle, so comparing two
+/// handles is a pointer compare, and the hash was computed when the string was
+/// interned. The default handle is the empty string, which is never stored.
+/// @note Handles are only valid while their pool is alive.
+class PooledString {
+    /// @brief Header in front of the characters, allocated by the pool.
+    struct Data {
+        std::size_t hash_;
+        std::uint32_t size_;
+
+        const char* chars() const {
+            return (const char*)(this + 1);
+        }
+    };
+
+    const Data* data_ = nullptr;
+
+    explicit PooledString(const Data* data) : data_(data) {}
+
+    friend class StringPool;
+
+public:
+    PooledString() = default;
+
+    /// @brief Returns the string, null terminated.
+    std::string_view str() const {
+        if(!data_) return {};
+        return {data_->chars(), data_->size_};
+    }
+
+    /// @brief Returns a pointer to the null terminated characters.
+    const char* c_str() const {
+        return data_ ? data_->chars() : "";
+    }
+
+    std::size_t size() const {
+        return data_ ? data_->size_ : 0;
+    }
+
+    bool empty() const {
+        return data_ == nullptr;
+    }
+
+    /// @brief Returns the hash of the string, the same as hashing `str()` with
+    /// `HMapInfo<std::string_view>`.
+    std::size_t hash() const {
+        return data_ ? data_->hash_ : HMapInfo<std::string_view>::hash({});
+    }
+
+    /// @brief Only meaningful for handles from the same pool.
+    bool operator==(const PooledString&) const = default;
+};
+
+template<>
+struct HMapInfo<PooledString> {
+    static std::size_t hash(PooledString s) {
+        return s.hash();
+    }
+
+    static bool equal(PooledString lhs, PooledString rhs) {
+        return lhs == rhs;
+    }
+};
+
+/// @brief Interns strings into arena storage.
+///
+/// Every distinct string is copied once into the pool's allocator and stays
+/// there until the pool is destroyed, so the returned handles and the views
+/// they hand out never dangle while the pool lives.
+class StringPool {
+    using Data = PooledString::Data;
+
+    struct DataInfo {
+        static std::size_t hash(const Data* d) {
+            return d->hash_;
+        }
+
+        static std::size_t hash(std::string_view s) {
+            return HMapInfo<std::string_view>::hash(s);
+        }
+
+        static bool equal(const Data* lhs, const Data* rhs) {
+            return lhs == rhs;
+        }
+
+        static bool equal(std::string_view lhs, const Data* rhs) {
+            return lhs.size() == rhs->size_ &&
+                   std::memcmp(lhs.data(), rhs->chars(), lhs.size()) == 0;
+        }
+    };
+
+    BumpAllocator allocator_;
+    HSet<const Data*, DataInfo> strings_;
+
+    /// @brief Copies `str` into the allocator behind its header.
+    const Data* copy(std::string_view str, std::size_t hash) {
+        void* mem =
+            allocator_.allocate(sizeof(Data) + str.size() + 1, alignof(Data));
+        Data* data = new(mem) Data{hash, std::uint32_t(str.size())};
+        char* chars = (char*)(data + 1);
+        std::memcpy(chars, str.data(), str.size());
+        chars[str.size()] = '\0';
+        return data;
+    }
+
+public:
+    /// @brief Creates an empty pool.
+    /// @param slabSize Size of the allocator's slabs.
+    explicit StringPool(
+        std::size_t slabSize = BumpAllocator::DEFAULT_SLAB_SIZE) :
+        allocator_(slabSize) {}
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    StringPool(StringPool&&) noexcept = default;
+    StringPool& operator=(StringPool&&) noexcept = default;
+
+    ~StringPool() = default;
+
+    /// @brief Returns the handle of `str`, copying it into the pool if it
+    /// isn't there yet.
+    PooledString intern(std::string_view str) {
+        if(str.empty()) return PooledString();
+        inr_assert(str.size() <= UINT32_MAX,
+                   "StringPool intern(): string too long");
+
+        // Hashed once, for the probe and for the header of a new string.
+        std::size_t hash = DataInfo::hash(str);
+        auto [e, inserted] = strings_.try_emplace_hashed(
+            str, hash, [&] { return copy(str, hash); });
+        return PooledString(*e);
+    }
+
+    /// @brief Returns the handle of `str` if it was interned, the empty handle
+    /// otherwise.
+    PooledString lookup(std::string_view str) const {
+        const Data* const* found = strings_.find(str);
+        return found ? PooledString(*found) : PooledString();
+    }
+
+    /// @brief Returns the amount of distinct strings in the pool.
+    std::size_t size() const {
+        return strings_.size();
+    }
+
+    /// @brief Returns the allocator the strings are stored in.
+    const BumpAllocator& getAllocator() const {
+        return allocator_;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_ADT_STRINGPOOL_H
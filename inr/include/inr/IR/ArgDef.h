@@ -10,8 +10,12 @@
 
 #include <inr/IR/Def.h>
 
+#include <cstdint>
+
 namespace inr {
 
+class FuncDef;
+
 /// @brief How should the type be extended when passed in or returned.
 enum class TypeExt : unsigned char {
     NoExt,
@@ -21,12 +25,25 @@ enum class TypeExt : unsigned char {
 
 /// @brief Represents a function argument.
 class ArgDef : public Def {
+    FuncDef* parent_;
     unsigned num_;
-    TypeExt ext_;
 
 public:
-    ArgDef(const Type* type, std::string_view name, unsigned num, TypeExt ext) :
-        Def(type, ArgDefType, name), num_(num), ext_(ext) {}
+    ArgDef(FuncDef* parent, const Type* type, PooledString name, unsigned num,
+           TypeExt ext) :
+        Def(type, ArgDefType, name), parent_(parent), num_(num) {
+        setExt(ext);
+    }
+
+    /// @brief Returns the function this argument belongs to.
+    FuncDef* getParent() {
+        return parent_;
+    }
+
+    /// @brief Returns the function this argument belongs to, const version.
+    const FuncDef* getParent() const {
+        return parent_;
+    }
 
     /// @brief Returns the position of this argument in a function.
     unsigned getArgPos() const {
@@ -34,11 +51,11 @@ public:
     }
 
     void setExt(TypeExt ext) {
-        ext_ = ext;
+        subclassID_ = std::uint8_t(ext);
     }
 
     TypeExt getExt() const {
-        return ext_;
+        return TypeExt(subclassID_);
     }
 };
 
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_BINARYFORMAT_H
+#define INERTIA_IR_BINARYFORMAT_H
+
+/// @file IR/BinaryFormat.h
+/// @brief Describes the binary IR format shared by the writer and reader.
+///
+/// Every integer is an unsigned LEB128 varint unless noted otherwise, strings
+/// and types are referred to by their index into the tables. A module is laid
+/// out as:
+/// ```
+/// magic "INRB", version
+/// strings: count, {size, bytes}...   index 0 is the empty string, not stored
+/// types:   count, {TypeID byte, payload}...
+///          Integer: width, Float: FPFormat byte, Function: ret, vararg byte,
+///          count, args...; a type only refers to types before it
+/// consts:  count, {type, limbs...}   as many limbs as the width needs
+/// undefs:  count, {type}...
+/// funcs:   count, {name, type, Linkage byte, TypeExt byte, CallingConv,
+///          {arg name, TypeExt byte}..., body size}...
+/// bodies:  the bodies of the functions, in order
+/// ```
+/// The function records are the index of the module, they can be read without
+/// touching any of the bodies, and a body only refers to the tables, so each
+/// one can be read on its own. A body is empty for declarations, otherwise
+/// it is:
+/// ```
+/// block count, instruction count, block names...,
+/// {instruction count, instructions...} for every block
+/// ```
+/// Functions are numbered in order, followed by the constants and the undefs,
+/// that's the global numbering. Within a body the args, the blocks and then
+/// the instructions are numbered in order, that's the local numbering. An
+/// instruction is its InstType as a byte followed by its fields, operands are
+/// encoded as `OperandKind`s.
+
+#include <cstdint>
+
+namespace inr {
+
+/// @brief First bytes of every binary module.
+constexpr char IR_BINARY_MAGIC[4] = {'I', 'N', 'R', 'B'};
+
+/// @brief Bumped on every incompatible change.
+constexpr std::uint32_t IR_BINARY_VERSION = 2;
+
+/// @brief Low bits of an operand, the rest of the bits are its `n`.
+enum class OperandKind : std::uint8_t {
+    /// @brief Local `n` before the instruction, it is already defined.
+    Back,
+    /// @brief Global `n`.
+    Global,
+    /// @brief Local `n` after the instruction, or the instruction itself if
+    /// `n` is zero. Followed by the type of the local, so it can be used
+    /// before it is read.
+    Forward,
+};
+
+/// @brief Amount of bits `OperandKind` takes in an operand.
+constexpr unsigned IR_BINARY_OPERAND_BITS = 2;
+
+} // namespace inr
+
+#endif // INERTIA_IR_BINARYFORMAT_H
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_BINARYREADER_H
+#define INERTIA_IR_BINARYREADER_H
+
+/// @file IR/BinaryReader.h
+/// @brief Provides a way to rebuild a unit from the binary IR format.
+
+#include <inr/ADT/ArrView.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/Materializer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/Stream.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace inr {
+
+/// @brief Reads modules written by `BinaryWriter`.
+///
+/// `read()` reads a whole module at once. Big modules can be opened instead,
+/// that only reads the tables and the function signatures, every body is
+/// materialized the first time it is accessed:
+/// ```cpp
+/// BinaryReader reader(unit, tm, data, &err());
+/// if(!reader.open()) return false;
+/// for(FuncDef& fn : unit.getFuncs()) {
+///     if(!isHot(fn)) continue;
+///     translate(fn); // Reads the body.
+///     reader.release(fn);
+/// }
+/// ```
+/// @note The data must outlive the reader, and the reader must outlive any
+/// access to the bodies. Bodies that weren't materialized when it is
+/// destroyed are left empty.
+class BinaryReader final : public Materializer {
+    class Reader;
+
+    TUnit& unit_;
+    std::unique_ptr<Reader> reader_;
+
+public:
+    /// @brief Creates a reader of `data` into `unit`, see `open()`.
+    /// @param unit Unit to add the functions to, usually an empty one.
+    /// @param tm Type map to get the types from.
+    /// @param data The whole module.
+    /// @param os Stream to print errors to, if any.
+    BinaryReader(TUnit& unit, TypeMap& tm, arrview<std::uint8_t> data,
+                 stream* os = nullptr);
+
+    BinaryReader(const BinaryReader&) = delete;
+    BinaryReader& operator=(const BinaryReader&) = delete;
+
+    ~BinaryReader() override;
+
+    /// @brief Reads everything but the bodies, and becomes the materializer
+    /// of the unit.
+    /// @return False if the data is malformed.
+    bool open();
+
+    /// @brief Reads the body of `fn`, use `FuncDef::materialize()` instead.
+    bool materialize(FuncDef& fn) override;
+
+    /// @brief Reads every body that wasn't read yet.
+    /// @return False if a body is malformed.
+    bool materializeAll();
+
+    /// @brief Frees the body of `fn`, it is read again if it is accessed.
+    /// @note Nothing outside of the function may use the body anymore.
+    void release(FuncDef& fn);
+
+    /// @brief Reads a module written by `BinaryWriter` into `unit`.
+    /// @param unit Unit to add the functions to, usually an empty one.
+    /// @param tm Type map to get the types from.
+    /// @param data The whole module.
+    /// @param os Stream to print the error to, if any.
+    /// @return False if the data is malformed, the unit should be discarded
+    /// then as it may be partially read.
+    static bool read(TUnit& unit, TypeMap& tm, arrview<std::uint8_t> data,
+                     stream* os = nullptr);
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_BINARYREADER_H
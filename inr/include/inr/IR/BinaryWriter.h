@@ -0,0 +1,28 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_BINARYWRITER_H
+#define INERTIA_IR_BINARYWRITER_H
+
+/// @file IR/BinaryWriter.h
+/// @brief Provides a way to serialize a unit into the binary IR format.
+
+#include <inr/IR/TUnit.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace inr {
+
+class BinaryWriter {
+public:
+    /// @brief Appends the binary form of `unit` to `out`.
+    /// @note See IR/BinaryFormat.h for the layout. The unit's name isn't
+    /// stored, the reader's unit keeps its own.
+    static void write(const TUnit& unit, std::vector<std::uint8_t>& out);
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_BINARYWRITER_H
@@ -17,17 +17,28 @@ namespace inr {
 
 class FuncDef;
 
+/// @brief Represents a basic block.
+/// @note Instructions in it are allocated from the unit's allocator.
 class BlockDef : public Def, public ilist_node<BlockDef> {
+    FuncDef* parent_;
+    /// @brief Instructions are trivially destructible, the block doesn't have
+    /// to visit them when it goes away.
     ilist<InstDef> instructions_;
 
-    BlockDef(const BlockType* bt, std::string_view name) :
-        Def(bt, BlockDefType, name) {}
+    BlockDef(FuncDef* parent, const BlockType* bt, PooledString name) :
+        Def(bt, BlockDefType, name), parent_(parent) {}
 
     friend class FuncDef;
 
 public:
-    ~BlockDef() override {
-        instructions_.deleteNodes();
+    /// @brief Returns the function this block belongs to.
+    FuncDef* getParent() {
+        return parent_;
+    }
+
+    /// @brief Returns the function this block belongs to, const version.
+    const FuncDef* getParent() const {
+        return parent_;
     }
 
     ilist<InstDef>& getInstructions() {
@@ -34,13 +34,10 @@ class ConstDef : public Def {
     friend class TUnit;
 
 public:
+    /// @note Constants are uniqued by the unit, so they can't be modified.
     const bigint& getInteger() const {
         return int_;
     }
-
-    bigint& getInteger() {
-        return int_;
-    }
 };
 
 } // namespace inr
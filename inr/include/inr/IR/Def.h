@@ -8,11 +8,12 @@
 /// @file IR/Def.h
 /// @brief Represents a definition.
 
-#include <inr/ADT/ArrView.h>
-#include <inr/ADT/IVector.h>
+#include <inr/ADT/StringPool.h>
 #include <inr/IR/Type.h>
+#include <inr/IR/Use.h>
 #include <inr/Support/Assert.h>
 
+#include <cstdint>
 #include <string_view>
 
 namespace inr {
@@ -24,9 +25,13 @@ namespace inr {
 /// rhs. For example an instruction, function, basic block, etc.. Those are all
 /// definitions, as all of the above can appear on the right hand side, have
 /// users, and are declared.
+///
+/// Defs have no vtable, the kind is dispatched on `getDefType()`. They are
+/// allocated by the unit and never deleted one by one, so only defs that own
+/// memory need their destructor to run.
 class Def {
 public:
-    enum DefType {
+    enum DefType : std::uint8_t {
         ArgDefType,
         BlockDefType,
         FuncDefType,
@@ -37,60 +42,130 @@ public:
 
 private:
     const Type* type_;
+    Use* useList_ = nullptr;
+    /// @brief Interned by the unit, see `TUnit::getNames()`.
+    PooledString name_;
     DefType defType_;
-    std::string_view name_;
-    ivec<Def*, 4> users_;
+
+protected:
+    /// @brief Spare bits for the derived classes, for example the instruction
+    /// kind. They fill what would be padding otherwise.
+    std::uint8_t subclassID_ = 0;
+    std::uint16_t subclassData_ = 0;
+
+private:
+    /// @brief Dense index of the def, see `getSlot()`.
+    std::uint32_t slot_ = 0;
+
+    friend class FuncDef;
+    friend class TUnit;
+    friend class Use;
 
 public:
     /// @brief Default constructor for a def.
-    Def(const Type* type, DefType defType, std::string_view name = {}) :
-        type_(type), defType_(defType), name_(name) {
+    Def(const Type* type, DefType defType, PooledString name = {}) :
+        type_(type), name_(name), defType_(defType) {
         inr_assert(type != nullptr, "Def Def(): passed in nullptr for type");
     }
 
     Def(const Def&) = delete;
     Def& operator=(const Def&) = delete;
 
-    Def(Def&&) noexcept = default;
-    Def& operator=(Def&&) noexcept = default;
+    Def(Def&&) = delete;
+    Def& operator=(Def&&) = delete;
 
-    virtual ~Def() = default;
+    ~Def() = default;
 
     /// @brief Returns this def's name.
     std::string_view getName() const {
+        return name_.str();
+    }
+
+    /// @brief Returns this def's interned name.
+    /// @note Names from the same unit compare by pointer, and carry their
+    /// hash, so prefer this over `getName()` as a key.
+    PooledString getPooledName() const {
         return name_;
     }
 
-    /// @brief Updates this def's name.
-    void setName(std::string_view name) {
+    /// @brief Updates this def's name to an already interned one.
+    /// @note `name` has to come from the pool of the def's unit.
+    void setName(PooledString name) {
         name_ = name;
     }
 
+    /// @brief Interns `name` into the unit's pool and updates this def's name.
+    /// @note Only functions, blocks, args and instructions in a block have a
+    /// unit to intern into, constants and undefs are unnamed.
+    void setName(std::string_view name);
+
+    /// @brief Returns the slot of this def.
+    ///
+    /// Args, blocks and instructions are numbered densely within their
+    /// function, functions, constants and undefs within their unit. The slot
+    /// is assigned on creation and only changes when the function is
+    /// renumbered, so it can index flat arrays instead of hashing the def.
+    /// @note See `DenseDefMap`.
+    std::uint32_t getSlot() const {
+        return slot_;
+    }
+
+    /// @brief Returns true if the def is numbered by the unit instead of a
+    /// function.
+    bool isUnitLevel() const {
+        switch(defType_) {
+            case FuncDefType:
+            case ConstDefType:
+            case UnDefDefType:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     /// @brief Returns the type of this def.
     const Type* getType() const {
         return type_;
     }
 
-    /// @brief Adds a user of this def.
-    void addUser(Def* def) {
-        inr_assert(def != nullptr, "Def addUser(): passed in a nullptr def");
-        users_.emplace_back(def);
+    /// @brief Returns the uses of this def, one for every operand using it.
+    use_range<Use> getUsers() {
+        return use_range<Use>(useList_);
     }
 
-    /// @brief Removes a user of this def.
-    void removeUser(Def* def) {
-        inr_assert(def != nullptr, "Def removeUser(): passed in a nullptr def");
-        users_.erase_if_found(def);
+    /// @brief Returns the uses of this def, const version.
+    use_range<const Use> getUsers() const {
+        return use_range<const Use>(useList_);
     }
 
-    /// @brief Returns the def's users.
-    arrview<Def*> getUsers() const {
-        return users_;
+    /// @brief Equivalent of doing `!getUsers().empty()`.
+    bool hasUsers() const {
+        return useList_ != nullptr;
     }
 
-    /// @brief Equivalent of doing `getUsers().size() != 0`.
-    bool hasUsers() const {
-        return users_.size() != 0;
+    /// @brief Returns true if this def is used exactly once.
+    bool hasOneUser() const {
+        return useList_ && !useList_->getNext();
+    }
+
+    /// @brief Counts the uses of this def.
+    /// @note Walks the whole use list.
+    unsigned getNumUsers() const {
+        unsigned count = 0;
+        for(const Use* use = useList_; use; use = use->getNext()) count++;
+        return count;
+    }
+
+    /// @brief Makes every use of this def use `def` instead.
+    void replaceAllUsesWith(Def* def) {
+        inr_assert(def != nullptr,
+                   "Def replaceAllUsesWith(): passed in a nullptr def");
+        inr_assert(def != this,
+                   "Def replaceAllUsesWith(): replacing a def with itself");
+        inr_assert(def->getType() == getType(),
+                   "Def replaceAllUsesWith(): types do not match");
+
+        while(useList_) useList_->set(def);
     }
 
     DefType getDefType() const {
@@ -98,6 +173,16 @@ public:
     }
 };
 
+inline Use::Use(UseDef* user, Def* val) : user_(user) {
+    set(val);
+}
+
+inline void Use::set(Def* val) {
+    if(val_) removeFromList();
+    val_ = val;
+    if(val_) addToList(&val_->useList_);
+}
+
 } // namespace inr
 
 #endif // INERTIA_IR_DEF_H
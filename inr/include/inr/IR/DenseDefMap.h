@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_DENSEDEFMAP_H
+#define INERTIA_IR_DENSEDEFMAP_H
+
+/// @file IR/DenseDefMap.h
+/// @brief Provides a map from defs to values indexed by their slots.
+
+#include <inr/IR/Def.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/TUnit.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace inr {
+
+/// @brief Maps defs to values through a flat array indexed by `getSlot()`.
+///
+/// A map is either for the args, blocks and instructions of one function, or
+/// for the functions, constants and undefs of a unit, since the two are
+/// numbered separately. Lookups are a bounds check and an index, there is no
+/// hashing. Defs created after the map was reset are still fine, the array
+/// grows to fit them.
+/// @note Renumbering the function invalidates the map.
+template<typename T>
+class DenseDefMap {
+public:
+    using size_type = std::size_t;
+
+private:
+    std::vector<std::optional<T>> values_;
+    size_type size_ = 0;
+    bool unitLevel_ = false;
+
+    void checkDef([[maybe_unused]] const Def* def) const {
+        inr_assert(def != nullptr, "DenseDefMap: passed in a nullptr def");
+        inr_assert(def->isUnitLevel() == unitLevel_,
+                   "DenseDefMap: def is numbered by a different owner");
+    }
+
+public:
+    /// @brief Creates an empty map for function level defs.
+    DenseDefMap() = default;
+
+    /// @brief Creates a map for the args, blocks and instructions of `fn`.
+    explicit DenseDefMap(const FuncDef& fn) {
+        reset(fn);
+    }
+
+    /// @brief Creates a map for the functions, constants and undefs of `unit`.
+    explicit DenseDefMap(const TUnit& unit) {
+        reset(unit);
+    }
+
+    /// @brief Clears the map, and sizes it for the defs of `fn`.
+    void reset(const FuncDef& fn) {
+        values_.clear();
+        values_.resize(fn.getNumSlots());
+        size_ = 0;
+        unitLevel_ = false;
+    }
+
+    /// @brief Clears the map, and sizes it for the unit level defs of `unit`.
+    void reset(const TUnit& unit) {
+        values_.clear();
+        values_.resize(unit.getNumSlots());
+        size_ = 0;
+        unitLevel_ = true;
+    }
+
+    /// @brief Inserts a value constructed from `args` if `def` is not mapped.
+    /// @return The value and whether it was inserted.
+    template<typename... Args>
+    std::pair<T*, bool> try_emplace(const Def* def, Args&&... args) {
+        checkDef(def);
+        size_type slot = def->getSlot();
+        if(slot >= values_.size()) [[unlikely]] {
+            values_.resize(slot + 1);
+        }
+
+        std::optional<T>& val = values_[slot];
+        if(val) return {&*val, false};
+
+        val.emplace(std::forward<Args>(args)...);
+        size_++;
+        return {&*val, true};
+    }
+
+    /// @brief Returns the value of `def`, nullptr if it isn't mapped.
+    T* find(const Def* def) {
+        checkDef(def);
+        size_type slot = def->getSlot();
+        if(slot >= values_.size() || !values_[slot]) return nullptr;
+        return &*values_[slot];
+    }
+
+    /// @brief Returns the value of `def`, nullptr if it isn't mapped, const
+    /// version.
+    const T* find(const Def* def) const {
+        checkDef(def);
+        size_type slot = def->getSlot();
+        if(slot >= values_.size() || !values_[slot]) return nullptr;
+        return &*values_[slot];
+    }
+
+    /// @brief Removes the value of `def`.
+    /// @return True if there was one.
+    bool erase(const Def* def) {
+        checkDef(def);
+        size_type slot = def->getSlot();
+        if(slot >= values_.size() || !values_[slot]) return false;
+        values_[slot].reset();
+        size_--;
+        return true;
+    }
+
+    /// @brief Returns the amount of mapped defs.
+    size_type size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_DENSEDEFMAP_H
@@ -16,61 +16,138 @@
 #include <inr/IR/GlobalDef.h>
 #include <inr/IR/Linkage.h>
 #include <inr/IR/Type.h>
+#include <inr/Support/Allocator.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <cstdint>
 
 namespace inr {
 
 class TUnit;
 
 /// @brief Function definition.
+/// @note Created by the `TUnit`, its args come from the unit's allocator and
+/// its blocks from `getAllocator()`.
+///
+/// The body of a function can be lazy, it is then created by the unit's
+/// `Materializer` the first time the blocks or slots are accessed.
 class FuncDef : public GlobalDef, public ilist_node<FuncDef> {
-    std::vector<ArgDef> args_;
+    TUnit* parent_;
+    /// @brief Where the body comes from, the unit's allocator by default.
+    BumpAllocator* alloc_;
+    ArgDef* args_ = nullptr;
+    /// @brief Kept here so the type isn't needed to walk the args.
+    unsigned numArgs_;
+    /// @brief Amount of slots handed out to the function's defs.
+    std::uint32_t numSlots_ = 0;
     ilist<BlockDef> blocks_;
     CallingConv cc_ = CallingConv::Default;
     TypeExt ext_;
+    /// @brief The body has not been materialized yet.
+    bool lazy_ = false;
 
-    void initArgs() {
-        const FuncType* type = (const FuncType*)getType();
-        for(unsigned i = 0; i < type->getNumArgs(); i++) {
-            args_.emplace_back(type->getArg(i), std::string_view{}, i,
-                               TypeExt::NoExt);
-        }
-    }
-
-    FuncDef(const FuncType* type, std::string_view name, Linkage linkage,
-            TypeExt retExt) :
-        GlobalDef(linkage, type, FuncDefType, name), ext_(retExt) {
-        initArgs();
-    }
+    FuncDef(TUnit* parent, const FuncType* type, PooledString name,
+            Linkage linkage, TypeExt retExt);
 
     BlockDef* createBlock(const BlockType* bt, std::string_view name);
 
+    bool materializeSlow();
+
+    /// @brief Gives `def` the next free slot of this function.
+    void assignSlot(Def* def) {
+        def->slot_ = numSlots_++;
+    }
+
+    friend class InstDef;
     friend class TUnit;
 
 public:
-    ~FuncDef() override {
-        blocks_.deleteNodes();
+    /// @brief Returns the unit this function belongs to.
+    TUnit* getParent() {
+        return parent_;
+    }
+
+    /// @brief Returns the unit this function belongs to, const version.
+    const TUnit* getParent() const {
+        return parent_;
     }
 
+    /// @brief Returns the blocks, materializing the body if it is lazy.
     ilist<BlockDef>& getBlocks() {
+        materialize();
         return blocks_;
     }
 
+    /// @brief Returns the blocks, materializing the body if it is lazy.
     const ilist<BlockDef>& getBlocks() const {
+        const_cast<FuncDef*>(this)->materialize();
         return blocks_;
     }
 
+    /// @brief Returns true if the body hasn't been materialized yet.
+    bool isMaterializable() const {
+        return lazy_;
+    }
+
+    /// @brief Creates the body with the unit's materializer if it is lazy.
+    /// @return False if the materializer failed, the function is left
+    /// without a body.
+    bool materialize() {
+        if(lazy_) [[unlikely]] return materializeSlow();
+        return true;
+    }
+
+    /// @brief Marks the body as lazy, the function must not have one.
+    /// @note The unit needs a materializer before the body is accessed.
+    void setMaterializable(bool lazy = true) {
+        inr_assert(blocks_.empty(),
+                   "FuncDef setMaterializable(): function has a body");
+        lazy_ = lazy;
+    }
+
+    /// @brief Returns the allocator the blocks and instructions come from.
+    BumpAllocator& getAllocator() {
+        return *alloc_;
+    }
+
+    /// @brief Gives the body an allocator of its own, owned by the unit, so
+    /// `releaseBody()` can free its memory.
+    /// @param slabSize Size of the allocator's slabs, sized to the body.
+    void useOwnAllocator(std::size_t slabSize);
+
+    /// @brief Removes the blocks and instructions, freeing their memory if
+    /// the body has its own allocator.
+    /// @note Nothing outside of the function may use them anymore.
+    void releaseBody();
+
     unsigned getNumArgs() const {
-        return args_.size();
+        return numArgs_;
     }
 
     ArgDef* getArg(unsigned i) {
+        inr_assert(i < getNumArgs(), "FuncDef getArg(): out of bounds");
         return &args_[i];
     }
 
     const ArgDef* getArg(unsigned i) const {
+        inr_assert(i < getNumArgs(), "FuncDef getArg() (const): out of bounds");
         return &args_[i];
     }
 
+    /// @brief Returns the amount of slots used by the args, blocks and
+    /// instructions, every slot is below this.
+    /// @note Removed defs leave holes, use `renumber()` to close them.
+    unsigned getNumSlots() const {
+        const_cast<FuncDef*>(this)->materialize();
+        return numSlots_;
+    }
+
+    /// @brief Numbers the args, blocks and instructions densely again, in
+    /// that order.
+    /// @note Invalidates any `DenseDefMap` of this function.
+    void renumber();
+
     TypeExt getRetExt() const {
         return ext_;
     }
@@ -20,7 +20,7 @@ class GlobalDef : public UseDef {
 public:
     /// @brief Default constructor for a global def.
     GlobalDef(Linkage linkage, const Type* type, DefType defType,
-              std::string_view name = {}) :
+              PooledString name = {}) :
         UseDef(type, defType, name), linkage_(linkage) {}
 
     /// @brief Returns the def's linkage.
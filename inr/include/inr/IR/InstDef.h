@@ -16,6 +16,10 @@
 #include <inr/IR/UseDef.h>
 #include <inr/Support/Assert.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
 namespace inr {
 
 class BlockDef;
@@ -24,7 +28,10 @@ class BlockDef;
 /// @note Use the static methods to create new instructions. NEVER use delete on
 /// them manually.
 ///
-/// Uses the UseDef's uses vector as its operands.
+/// Uses the UseDef's uses as its operands. They are allocated right in front of
+/// the instruction, so an instruction is a single allocation sized to its
+/// arity. Instructions are trivially destructible, blocks and units do not have
+/// to visit them when they are torn down.
 class InstDef : public UseDef, public ilist_node<InstDef> {
 public:
     /// @brief Every possible instruction type in the IR.
@@ -197,21 +204,63 @@ public:
     };
 
 private:
-    InstType instType_;
+    /// @brief Set when the instruction is appended to a block.
+    BlockDef* parent_ = nullptr;
 
 protected:
-    InstDef(const Type* type, std::string_view name, InstType instType) :
-        UseDef(type, InstDefType, name), instType_(instType) {}
+    /// @brief Constructs an instruction with room for `numUses` operands.
+    /// @note `numUses` and `hungOffUses` have to match the ones passed to
+    /// `operator new`.
+    InstDef(const Type* type, PooledString name, InstType instType,
+            unsigned numUses, bool hungOffUses = false) :
+        UseDef(type, InstDefType, name, numUses, hungOffUses) {
+        subclassID_ = std::uint8_t(instType);
+    }
+
+    /// @brief Allocates the instruction from the allocator of the block's unit,
+    /// with room for `numUses` operands in front of it, or for a pointer to
+    /// the operands if they are hung off.
+    static void* operator new(std::size_t size, BlockDef* blk,
+                              unsigned numUses, bool hungOffUses = false);
+
+    /// @brief Only used if a constructor throws, the unit owns the memory.
+    static void operator delete(void*, BlockDef*, unsigned, bool) {}
+
+    /// @brief Numbers the instruction and appends it to the block.
+    static void appendTo(BlockDef* blk, InstDef* inst);
+
+    /// @brief Interns `name` into the pool of the block's unit.
+    static PooledString internName(BlockDef* blk, std::string_view name);
+
+    /// @brief Typed version of `appendTo()`, used by the factories.
+    template<typename T>
+    static T* append(BlockDef* blk, T* inst) {
+        appendTo(blk, inst);
+        return inst;
+    }
 
 public:
+    /// @brief The memory is owned by the unit.
+    static void operator delete(void*) = delete;
+
     /// @brief Returns the instruction kind of this instruction.
     InstType getInstType() const {
-        return instType_;
+        return InstType(subclassID_);
+    }
+
+    /// @brief Returns the block this instruction is in.
+    BlockDef* getParent() {
+        return parent_;
+    }
+
+    /// @brief Returns the block this instruction is in, const version.
+    const BlockDef* getParent() const {
+        return parent_;
     }
 
     /// @brief Returns true if this instruction terminates the block.
     bool isTerminator() const {
-        switch(instType_) {
+        switch(getInstType()) {
             case Ret:
             case Jmp:
             case Unreachable:
@@ -224,11 +273,11 @@ public:
 
 /// @brief Represents the `ret` instruction.
 class RetInst : public InstDef {
-    RetInst(const Type* type, Def* retVal) : InstDef(type, {}, Ret) {
+    RetInst(const Type* type, Def* retVal) : InstDef(type, {}, Ret, 1) {
         addUse(retVal);
     }
 
-    RetInst(const Type* type) : InstDef(type, {}, Ret) {}
+    RetInst(const Type* type) : InstDef(type, {}, Ret, 0) {}
 
 public:
     /// @brief Creates a new return instruction.
@@ -259,12 +308,12 @@ public:
 
 /// @brief Represents the `jmp` instruction.
 class JmpInst : public InstDef {
-    JmpInst(const VoidType* type, Def* lbl) : InstDef(type, {}, Jmp) {
+    JmpInst(const VoidType* type, Def* lbl) : InstDef(type, {}, Jmp, 1) {
         addUse(lbl);
     }
 
     JmpInst(const VoidType* type, Def* cond, Def* iftrue, Def* iffalse) :
-        InstDef(type, {}, Jmp) {
+        InstDef(type, {}, Jmp, 3) {
         addUse(cond);
         addUse(iftrue);
         addUse(iffalse);
@@ -348,9 +397,9 @@ public:
 /// @note Should not be used, use the derived classes instead.
 class BinaryInst : public InstDef {
 protected:
-    BinaryInst(const Type* type, std::string_view name, InstType instType,
+    BinaryInst(const Type* type, PooledString name, InstType instType,
                Def* lhs, Def* rhs) :
-        InstDef(type, name, instType) {
+        InstDef(type, name, instType, 2) {
         addUse(lhs);
         addUse(rhs);
     }
@@ -398,16 +447,16 @@ public:
     };
 
 private:
-    CmpCond cond_;
-
-    CmpInst(const Type* type, std::string_view name, CmpCond cond, Def* lhs,
+    CmpInst(const Type* type, PooledString name, CmpCond cond, Def* lhs,
             Def* rhs) :
-        BinaryInst(type, name, Cmp, lhs, rhs), cond_(cond) {}
+        BinaryInst(type, name, Cmp, lhs, rhs) {
+        subclassData_ = std::uint16_t(cond);
+    }
 
 public:
     /// @brief Returns the condition of this comparison.
     CmpCond getCond() const {
-        return cond_;
+        return CmpCond(subclassData_);
     }
 
     /// @brief Creates a new comparison instruction.
@@ -422,7 +471,7 @@ public:
 
 /// @brief Represents the `mul` instruction.
 class MulInst : public BinaryInst {
-    MulInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    MulInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Mul, lhs, rhs) {}
 
 public:
@@ -437,7 +486,7 @@ public:
 
 /// @brief Represents the `udiv` instruction.
 class UDivInst : public BinaryInst {
-    UDivInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    UDivInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, UDiv, lhs, rhs) {}
 
 public:
@@ -452,7 +501,7 @@ public:
 
 /// @brief Represents the `sdiv` instruction.
 class SDivInst : public BinaryInst {
-    SDivInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    SDivInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, SDiv, lhs, rhs) {}
 
 public:
@@ -467,7 +516,7 @@ public:
 
 /// @brief Represents the `urem` instruction.
 class URemInst : public BinaryInst {
-    URemInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    URemInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, URem, lhs, rhs) {}
 
 public:
@@ -482,7 +531,7 @@ public:
 
 /// @brief Represents the `srem` instruction.
 class SRemInst : public BinaryInst {
-    SRemInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    SRemInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, SRem, lhs, rhs) {}
 
 public:
@@ -497,7 +546,7 @@ public:
 
 /// @brief Represents the `add` instruction.
 class AddInst : public BinaryInst {
-    AddInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    AddInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Add, lhs, rhs) {}
 
 public:
@@ -512,7 +561,7 @@ public:
 
 /// @brief Represents the `sub` instruction.
 class SubInst : public BinaryInst {
-    SubInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    SubInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Sub, lhs, rhs) {}
 
 public:
@@ -527,7 +576,7 @@ public:
 
 /// @brief Represents the `shl` instruction.
 class ShlInst : public BinaryInst {
-    ShlInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    ShlInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Shl, lhs, rhs) {}
 
 public:
@@ -542,7 +591,7 @@ public:
 
 /// @brief Represents the `lshr` instruction.
 class LShrInst : public BinaryInst {
-    LShrInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    LShrInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, LShr, lhs, rhs) {}
 
 public:
@@ -557,7 +606,7 @@ public:
 
 /// @brief Represents the `ashr` instruction.
 class AShrInst : public BinaryInst {
-    AShrInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    AShrInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, AShr, lhs, rhs) {}
 
 public:
@@ -572,7 +621,7 @@ public:
 
 /// @brief Represents the `and` instruction.
 class AndInst : public BinaryInst {
-    AndInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    AndInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, And, lhs, rhs) {}
 
 public:
@@ -587,7 +636,7 @@ public:
 
 /// @brief Represents the `or` instruction.
 class OrInst : public BinaryInst {
-    OrInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    OrInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Or, lhs, rhs) {}
 
 public:
@@ -602,7 +651,7 @@ public:
 
 /// @brief Represents the `xor` instruction.
 class XorInst : public BinaryInst {
-    XorInst(const Type* type, std::string_view name, Def* lhs, Def* rhs) :
+    XorInst(const Type* type, PooledString name, Def* lhs, Def* rhs) :
         BinaryInst(type, name, Xor, lhs, rhs) {}
 
 public:
@@ -616,11 +665,21 @@ public:
 };
 
 /// @brief Represents the `phi` instruction.
+///
+/// The incoming values can't be allocated together with the instruction, so
+/// they live in a separate array that is reallocated from the unit when it is
+/// full. The incoming blocks are stored right after the uses in that array.
 class PhiInst : public InstDef {
-    ivec<BlockDef*, 4> block_;
+    PhiInst(const Type* type, PooledString name) :
+        InstDef(type, name, Phi, 0, true) {}
+
+    BlockDef** getBlockArray() const {
+        return reinterpret_cast<BlockDef**>(getUseArray() + getUseCapacity());
+    }
 
-    PhiInst(const Type* type, std::string_view name) :
-        InstDef(type, name, Phi) {}
+    /// @brief Makes room for more incoming values, allocating from the unit
+    /// `blk` belongs to.
+    void growIncoming(BlockDef* blk);
 
 public:
     /// @brief Creates a new phi instruction.
@@ -632,7 +691,7 @@ public:
                               std::string_view name = {});
 
     arrview<BlockDef*> getBlocks() const {
-        return block_;
+        return {getBlockArray(), getIncomingCount()};
     }
 
     /// @brief Adds an incoming value for this phi node.
@@ -643,18 +702,20 @@ public:
                    "PhiInst addIncoming(): passed in a nullptr def");
         inr_assert(blk != nullptr,
                    "PhiInst addIncoming(): passed in a nullprt block");
+        unsigned n = getIncomingCount();
+        if(n == getUseCapacity()) growIncoming(blk);
         addUse(def);
-        block_.emplace_back(blk);
+        getBlockArray()[n] = blk;
     }
 
     /// @brief Returns the def and block of an incoming value.
     std::pair<Def*, BlockDef*> getIncoming(unsigned i) {
-        return {getUses()[i], block_[i]};
+        return {getUses()[i], getBlocks()[i]};
     }
 
     /// @brief Returns the def and block of an incoming value, const version.
     std::pair<const Def*, const BlockDef*> getIncoming(unsigned i) const {
-        return {getUses()[i], block_[i]};
+        return {getUses()[i], getBlocks()[i]};
     }
 
     unsigned getIncomingCount() const {
@@ -664,7 +725,7 @@ public:
 
 /// @brief Represents the `unreachable` instruction.
 class UnreachableInst : public InstDef {
-    UnreachableInst(const VoidType* vt) : InstDef(vt, {}, Unreachable) {}
+    UnreachableInst(const VoidType* vt) : InstDef(vt, {}, Unreachable, 0) {}
 
 public:
     /// @brief Creates a new unreachable instruction.
@@ -674,8 +735,8 @@ public:
 
 /// @brief Represents the `load` instruction.
 class LoadInst : public InstDef {
-    LoadInst(const Type* type, std::string_view name, Def* from) :
-        InstDef(type, name, Load) {
+    LoadInst(const Type* type, PooledString name, Def* from) :
+        InstDef(type, name, Load, 1) {
         addUse(from);
     }
 
@@ -701,7 +762,8 @@ public:
 
 /// @brief Represents the `store` instruction.
 class StoreInst : public InstDef {
-    StoreInst(const VoidType* vt, Def* to, Def* from) : InstDef(vt, {}, Store) {
+    StoreInst(const VoidType* vt, Def* to, Def* from) :
+        InstDef(vt, {}, Store, 2) {
         addUse(to);
         addUse(from);
     }
@@ -738,9 +800,9 @@ public:
 /// @brief Represents the `alloca` instruction.
 class AllocaInst : public InstDef {
     const Type* allocates_;
-    AllocaInst(const PtrType* ptr, std::string_view name, const Type* t,
+    AllocaInst(const PtrType* ptr, PooledString name, const Type* t,
                Def* count) :
-        InstDef(ptr, name, Alloca), allocates_(t) {
+        InstDef(ptr, name, Alloca, 1), allocates_(t) {
         addUse(count);
     }
 
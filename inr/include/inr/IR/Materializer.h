@@ -0,0 +1,29 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_MATERIALIZER_H
+#define INERTIA_IR_MATERIALIZER_H
+
+/// @file IR/Materializer.h
+/// @brief Provides the interface for loading function bodies lazily.
+
+namespace inr {
+
+class FuncDef;
+
+/// @brief Creates the bodies of lazy functions when they are first accessed.
+/// @note Set on the unit with `TUnit::setMaterializer()`.
+class Materializer {
+public:
+    virtual ~Materializer() = default;
+
+    /// @brief Creates the blocks and instructions of `fn`.
+    /// @return False if the body couldn't be read, `fn` is left without a
+    /// body then.
+    virtual bool materialize(FuncDef& fn) = 0;
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_MATERIALIZER_H
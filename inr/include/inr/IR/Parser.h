@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_PARSER_H
+#define INERTIA_IR_PARSER_H
+
+/// @file IR/Parser.h
+/// @brief Contains the textual IR parser class.
+
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/Stream.h>
+
+#include <string_view>
+
+namespace inr {
+
+/// @brief Reads the IR back from the text `IRPrinter` writes.
+///
+/// The source is parsed in place, names are looked up as views into it and
+/// are only copied once, when they are interned into the unit. Values and
+/// blocks can be used before they are defined. Names that are only digits
+/// are the printer's numbering, those defs are left unnamed.
+/// @note The `module.name` line is skipped, the unit keeps its own name. The
+/// IR isn't verified, use `Verifier` for that.
+class IRParser {
+public:
+    /// @brief Parses the functions in `src` into `unit`.
+    /// @param unit Unit to add the functions to.
+    /// @param tm Type map to get the types from.
+    /// @param src The text, only has to live for the call.
+    /// @param os Stream to print the error to, with its line and column.
+    /// @return False on a syntax error, the unit should be discarded then as
+    /// it may be partially parsed.
+    static bool parse(TUnit& unit, TypeMap& tm, std::string_view src,
+                      stream* os = nullptr);
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_PARSER_H
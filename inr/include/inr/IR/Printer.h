@@ -4,7 +4,7 @@
 /// @file IR/Printer.h
 /// @brief Contains the IR printer class.
 
-#include <inr/ADT/HMap.h>
+#include <inr/IR/DenseDefMap.h>
 #include <inr/IR/InstDef.h>
 #include <inr/IR/TUnit.h>
 #include <inr/Support/Stream.h>
@@ -15,12 +15,15 @@ namespace inr {
 
 /// @brief Prints out the IR.
 class IRPrinter {
-    uint32_t counter_;
-    HMap<const Def*, uint32_t> defNames_;
+    uint32_t counter_ = 0;
+    /// @brief Numbers of the unnamed defs in the function being printed.
+    DenseDefMap<uint32_t> defNames_;
+    /// @brief Numbers of the unnamed functions.
+    DenseDefMap<uint32_t> globalNames_;
     const TUnit& unit_;
 
 public:
-    IRPrinter(const TUnit& unit) : unit_(unit) {}
+    IRPrinter(const TUnit& unit) : globalNames_(unit), unit_(unit) {}
 
     stream& printDef(stream& os, const Def* def, bool prefix = true);
 
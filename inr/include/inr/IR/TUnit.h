@@ -8,16 +8,24 @@
 /// @file IR/TUnit.h
 /// @brief Provides a class representing a translation unit.
 
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HSet.h>
 #include <inr/ADT/IList.h>
+#include <inr/ADT/StringPool.h>
 #include <inr/IR/ArgDef.h>
 #include <inr/IR/BlockDef.h>
 #include <inr/IR/ConstDef.h>
 #include <inr/IR/FuncDef.h>
 #include <inr/IR/Linkage.h>
+#include <inr/IR/Materializer.h>
 #include <inr/IR/Type.h>
 #include <inr/IR/TypeMap.h>
 #include <inr/IR/UnDef.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Support/Allocator.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -42,24 +50,111 @@ namespace inr {
 /// ```
 /// Basically meaning this class holds all the declarations and definitions for
 /// one unit.
+///
+/// Every def in the unit (functions, blocks, instructions, constants, etc..) is
+/// allocated from the unit's allocator, and is released all at once when the
+/// unit is destroyed.
 class TUnit {
+    /// @brief Must be declared first, so it outlives every def.
+    BumpAllocator allocator_;
     /// @brief Used for debugging.
     /// @note Usually goes into the `.file` directive.
     std::string_view name_;
+    /// @brief Names of the defs, interned so they don't have to outlive the
+    /// caller's strings.
+    StringPool names_;
     ilist<FuncDef> funcs_;
-    std::vector<std::unique_ptr<Def>> defStorage_;
+    /// @brief Amount of slots handed out to functions, constants and undefs.
+    std::uint32_t numSlots_ = 0;
 
-public:
-    TUnit(std::string_view name) : name_(name) {}
+    /// @brief Hashes constants by their type and limbs, defined in TUnit.cpp.
+    struct ConstInfo;
+    /// @brief Every constant in the unit, each value exists only once.
+    HSet<ConstDef*, ConstInfo> consts_;
+    /// @brief Constants wider than a limb own memory, so they are the only
+    /// defs that have to be destroyed with the unit.
+    std::vector<ConstDef*> wideConsts_;
+    /// @brief One undef per type.
+    HMap<const Type*, UnDef*> undefs_;
+    /// @brief Allocators of the function bodies that can be released on
+    /// their own, see `FuncDef::useOwnAllocator()`.
+    std::vector<std::unique_ptr<BumpAllocator>> bodyAllocators_;
+    /// @brief Creates the bodies of lazy functions, if any.
+    Materializer* materializer_ = nullptr;
 
-    ~TUnit() {
-        funcs_.deleteNodes();
+    ConstDef* findConst(const IntType* type, const bigint::Limb* limbs,
+                        unsigned count) const;
+    ConstDef* insertConst(ConstDef* c);
+
+    /// @brief Gives `def` the next free slot of this unit.
+    void assignSlot(Def* def) {
+        def->slot_ = numSlots_++;
     }
 
+    /// @brief Creates an allocator that lives as long as the unit.
+    BumpAllocator* createBodyAllocator(std::size_t slabSize) {
+        bodyAllocators_.push_back(std::make_unique<BumpAllocator>(slabSize));
+        return bodyAllocators_.back().get();
+    }
+
+    friend class FuncDef;
+
+public:
+    /// @brief Creates a new translation unit.
+    /// @param name Name of the unit.
+    /// @param slabSize Size of the allocator's slabs, see `getAllocator()`.
+    TUnit(std::string_view name,
+          std::size_t slabSize = BumpAllocator::DEFAULT_SLAB_SIZE) :
+        allocator_(slabSize), name_(name) {}
+
+    TUnit(const TUnit&) = delete;
+    TUnit& operator=(const TUnit&) = delete;
+
+    // Defs point back to their unit, so it can't be moved either.
+
+    TUnit(TUnit&&) = delete;
+    TUnit& operator=(TUnit&&) = delete;
+
+    ~TUnit();
+
     std::string_view getName() const {
         return name_;
     }
 
+    /// @brief Returns the allocator all of the unit's defs come from.
+    BumpAllocator& getAllocator() {
+        return allocator_;
+    }
+
+    /// @brief Returns the allocator all of the unit's defs come from.
+    /// @note Useful to check `getBytesAllocated()` to size the slabs.
+    const BumpAllocator& getAllocator() const {
+        return allocator_;
+    }
+
+    /// @brief Returns the materializer of the lazy functions, if any.
+    Materializer* getMaterializer() const {
+        return materializer_;
+    }
+
+    /// @brief Sets who creates the bodies of lazy functions.
+    /// @note See `FuncDef::setMaterializable()`.
+    void setMaterializer(Materializer* materializer) {
+        materializer_ = materializer;
+    }
+
+    /// @brief Returns the pool the names of the unit's defs are interned in.
+    /// @note `createFunction()`, `createBlock()` and the instruction factories
+    /// intern names themselves, use this for `Def::setName()`.
+    StringPool& getNames() {
+        return names_;
+    }
+
+    /// @brief Returns the pool the names of the unit's defs are interned in.
+    const StringPool& getNames() const {
+        return names_;
+    }
+
     const ilist<FuncDef>& getFuncs() const {
         return funcs_;
     }
@@ -68,12 +163,28 @@ public:
         return funcs_;
     }
 
+    /// @brief Returns the amount of slots used by the functions, constants
+    /// and undefs, every slot is below this.
+    unsigned getNumSlots() const {
+        return numSlots_;
+    }
+
     FuncDef* createFunction(const FuncType* type, std::string_view name,
                             Linkage linkage, TypeExt retExt);
     BlockDef* createBlock(TypeMap& tm, FuncDef* to, std::string_view name);
 
+    /// @brief Returns the constant of `type` with the value `val`.
+    /// @note Constants are uniqued, the same value always returns the same
+    /// def, so they can be compared by their pointers.
     ConstDef* createConst(const IntType* type, const bigint& val);
+    /// @brief Returns the constant of `type` with the value `val`, the bigint
+    /// is only moved from if the constant doesn't exist yet.
     ConstDef* createConst(const IntType* type, bigint&& val);
+    /// @brief Returns the constant of `type` with the value `val`.
+    /// @note Values wider than the type are truncated. Doesn't need a bigint
+    /// if the type fits into a single limb.
+    ConstDef* createConst(const IntType* type, bigint::Limb val);
+    /// @brief Returns the undef of type `t`, uniqued like the constants.
     UnDef* createUndef(const Type* t);
 };
 
@@ -11,6 +11,7 @@
 #include <inr/ADT/ArrView.h>
 #include <inr/Math/FPFormat.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace inr {
@@ -144,12 +145,15 @@ class FuncType final : public Type {
     const Type* ret_;
     std::vector<const Type*> args_;
     bool vararg_;
+    std::size_t hash_;
 
-    FuncType(const Type* ret, arrview<const Type*> args, bool vararg) :
+    FuncType(const Type* ret, arrview<const Type*> args, bool vararg,
+             std::size_t hash) :
         Type(Function),
         ret_(ret),
         args_(args.begin(), args.end()),
-        vararg_(vararg) {}
+        vararg_(vararg),
+        hash_(hash) {}
 
 public:
     const Type* getReturn() const {
@@ -168,6 +172,12 @@ public:
         return vararg_;
     }
 
+    /// @brief Returns the hash of the signature, computed once by the
+    /// TypeMap.
+    std::size_t getHash() const {
+        return hash_;
+    }
+
     friend class TypeMapInternal;
 };
 
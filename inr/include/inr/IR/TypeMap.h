@@ -17,6 +17,11 @@ namespace inr {
 class TypeMapInternal;
 
 /// @brief Provides unique types to allow pointer comparisons.
+///
+/// A TypeMap can be shared by threads building IR for the same unit. Getting
+/// a type that already exists takes no lock, creating one locks only a part of
+/// the map, and every returned type lives as long as the map.
+/// @note Moving and destroying the map are not thread safe.
 class TypeMap {
     TypeMapInternal* internal_;
 
@@ -0,0 +1,166 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_IR_USE_H
+#define INERTIA_IR_USE_H
+
+/// @file IR/Use.h
+/// @brief Provides the use (edge between a def and its user).
+
+#include <cstddef>
+#include <iterator>
+
+namespace inr {
+
+class Def;
+class UseDef;
+
+/// @brief A single use of a def.
+/// @note This class' equivalent is LLVM's `Use` class.
+///
+/// Every operand of a UseDef is a `Use`. The use is linked into the used def's
+/// user list, so it can be removed from it in O(1) without searching. Uses are
+/// never copied, moving one relinks it, which keeps them valid inside of a
+/// growing vector.
+class Use {
+    Def* val_ = nullptr;
+    UseDef* user_;
+    Use* next_ = nullptr;
+    /// @brief Points to the previous use's `next_`, or to the list head.
+    Use** prev_ = nullptr;
+
+    friend class Def;
+
+    void addToList(Use** head) {
+        next_ = *head;
+        if(next_) next_->prev_ = &next_;
+        prev_ = head;
+        *head = this;
+    }
+
+    void removeFromList() {
+        *prev_ = next_;
+        if(next_) next_->prev_ = prev_;
+    }
+
+public:
+    /// @brief Creates a use of `val` by `user`.
+    /// @note Defined in IR/Def.h.
+    Use(UseDef* user, Def* val);
+
+    Use(const Use&) = delete;
+    Use& operator=(const Use&) = delete;
+
+    /// @brief Moves the use, relinking it in place of the other one.
+    Use(Use&& other) noexcept :
+        val_(other.val_),
+        user_(other.user_),
+        next_(other.next_),
+        prev_(other.prev_) {
+        if(val_) {
+            *prev_ = this;
+            if(next_) next_->prev_ = &next_;
+        }
+        other.val_ = nullptr;
+    }
+
+    Use& operator=(Use&&) = delete;
+
+    /// @brief Does not unlink the use, use `set(nullptr)` for that.
+    ///
+    /// Whole units are torn down at once, so there is nothing to unlink from.
+    ~Use() = default;
+
+    /// @brief Returns the used def.
+    Def* get() const {
+        return val_;
+    }
+
+    /// @brief Returns the def that holds this use.
+    UseDef* getUser() const {
+        return user_;
+    }
+
+    /// @brief Returns the next use of the same def.
+    Use* getNext() const {
+        return next_;
+    }
+
+    /// @brief Makes this use point to another def.
+    /// @note Defined in IR/Def.h.
+    void set(Def* val);
+
+    operator Def*() const {
+        return val_;
+    }
+
+    Def* operator->() const {
+        return val_;
+    }
+};
+
+/// @brief Forward iterator over the use list of a def.
+template<typename UseT>
+class use_iterator {
+    UseT* cur_ = nullptr;
+
+public:
+    using value_type = UseT;
+    using pointer = UseT*;
+    using reference = UseT&;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    use_iterator() = default;
+    explicit use_iterator(UseT* cur) : cur_(cur) {}
+
+    reference operator*() const {
+        return *cur_;
+    }
+
+    pointer operator->() const {
+        return cur_;
+    }
+
+    use_iterator& operator++() {
+        cur_ = cur_->getNext();
+        return *this;
+    }
+
+    use_iterator operator++(int) {
+        use_iterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool operator==(const use_iterator&) const = default;
+};
+
+/// @brief Range over the use list of a def, returned by `Def::getUsers()`.
+/// @note Changing any of the uses invalidates this.
+template<typename UseT>
+class use_range {
+    UseT* head_;
+
+public:
+    using iterator = use_iterator<UseT>;
+
+    explicit use_range(UseT* head) : head_(head) {}
+
+    iterator begin() const {
+        return iterator(head_);
+    }
+
+    iterator end() const {
+        return iterator();
+    }
+
+    bool empty() const {
+        return head_ == nullptr;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_IR_USE_H
@@ -9,38 +9,103 @@
 /// @brief A definition that uses other ones.
 
 #include <inr/ADT/ArrView.h>
-#include <inr/ADT/IVector.h>
 #include <inr/IR/Def.h>
 #include <inr/IR/Type.h>
+#include <inr/IR/Use.h>
 #include <inr/Support/Assert.h>
 
+#include <cstdint>
+#include <new>
+#include <utility>
+
 namespace inr {
 
 /// @brief A def that tracks its uses.
+///
+/// The UseDef does not own the memory of its uses. Instructions allocate them
+/// right in front of themselves, sized exactly to their arity, so finding them
+/// only takes the capacity. Defs with a variable amount of uses (phi nodes)
+/// have "hung off" uses instead, a pointer in front of the def points to a
+/// separate array that is replaced when it grows.
 class UseDef : public Def {
-    ivec<Def*, 4> uses_;
+    std::uint32_t numUses_ = 0;
+    std::uint32_t capUses_ : 31 = 0;
+    std::uint32_t hungOffUses_ : 1 = 0;
+
+    Use*& getHungOffUses() const {
+        return reinterpret_cast<Use**>(const_cast<UseDef*>(this))[-1];
+    }
+
+protected:
+    /// @brief Constructs a UseDef that has room for `capacity` uses.
+    /// @param hungOffUses If true `capacity` must be zero, and a pointer to the
+    /// uses is expected to be in front of the def.
+    /// @note The memory for the uses must be allocated in front of the def, so
+    /// the UseDef must be the first base of the object.
+    UseDef(const Type* type, DefType defType, PooledString name,
+           unsigned capacity, bool hungOffUses) :
+        Def(type, defType, name),
+        capUses_(capacity),
+        hungOffUses_(hungOffUses) {
+        inr_assert(!hungOffUses || !capacity,
+                   "UseDef UseDef(): hung off uses start out empty");
+        if(hungOffUses) getHungOffUses() = nullptr;
+    }
+
+    /// @brief Returns the amount of uses that fit without moving them.
+    unsigned getUseCapacity() const {
+        return capUses_;
+    }
+
+    /// @brief Returns the start of the use array.
+    Use* getUseArray() const {
+        if(hungOffUses_) return getHungOffUses();
+        return reinterpret_cast<Use*>(const_cast<UseDef*>(this)) - capUses_;
+    }
+
+    /// @brief Moves the uses into `uses`, which has room for `capacity` uses.
+    /// @note Only for hung off uses. The old array is not freed, it belongs to
+    /// whoever allocated it.
+    void moveUses(Use* uses, unsigned capacity) {
+        inr_assert(hungOffUses_, "UseDef moveUses(): uses are not hung off");
+        inr_assert(capacity >= numUses_,
+                   "UseDef moveUses(): capacity is smaller than the size");
+        Use* old = getUseArray();
+        for(unsigned i = 0; i < numUses_; i++) {
+            new(uses + i) Use(std::move(old[i]));
+        }
+        getHungOffUses() = uses;
+        capUses_ = capacity;
+    }
 
 public:
-    /// @brief Default constructor for a UseDef.
-    UseDef(const Type* type, DefType defType, std::string_view name = {}) :
+    /// @brief Default constructor for a UseDef, without any room for uses.
+    UseDef(const Type* type, DefType defType, PooledString name = {}) :
         Def(type, defType, name) {}
 
     /// @brief Adds the def to uses, and adds itself to its users.
     void addUse(Def* def) {
         inr_assert(def != nullptr, "UseDef addUse(): passed in a nullptr def");
-        uses_.emplace_back(def);
-        def->addUser(this);
+        inr_assert(numUses_ < capUses_, "UseDef addUse(): no room left");
+        new(getUseArray() + numUses_++) Use(this, def);
+    }
+
+    /// @brief Replaces the use at index `i` with `def`.
+    void setUse(unsigned i, Def* def) {
+        inr_assert(def != nullptr, "UseDef setUse(): passed in a nullptr def");
+        inr_assert(i < numUses_, "UseDef setUse(): out of bounds");
+        getUseArray()[i].set(def);
     }
 
     /// @brief Removes the uses, and removes itself from the users.
     void removeUses() {
-        for(auto it = uses_.rbegin(); it != uses_.rend(); ++it) {
-            (*it)->removeUser(this);
-        }
+        Use* uses = getUseArray();
+        for(unsigned i = 0; i < numUses_; i++) uses[i].set(nullptr);
+        numUses_ = 0;
     }
 
-    arrview<Def*> getUses() const {
-        return uses_;
+    arrview<Use> getUses() const {
+        return {getUseArray(), numUses_};
     }
 };
 
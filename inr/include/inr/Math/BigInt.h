@@ -8,8 +8,11 @@
 /// @file Math/BigInt.h
 /// @brief Provides a class that can store arbitrary precision integers.
 
+#include <inr/ADT/Relocate.h>
+
 #include <climits>
 #include <cstdint>
+#include <type_traits>
 
 namespace inr {
 
@@ -81,6 +84,11 @@ public:
 
     bigint(unsigned bits, Limb val, bool signExt = false);
 
+    /// @brief Creates a bigint from its limbs, least significant first.
+    /// @note Reads as many limbs as `getLimbCount()` would return for `bits`,
+    /// the bits above `bits` are ignored.
+    static bigint fromLimbs(unsigned bits, const Limb* limbs);
+
     bigint(const bigint&);
     bigint& operator=(const bigint&);
 
@@ -116,6 +124,12 @@ public:
         return isOnHeap() ? (getAllocatedBits() / LIMB_BITS) : 1;
     }
 
+    /// @brief Returns the limbs of this bigint, least significant first.
+    /// @note There are `getLimbCount()` limbs, the unused top bits are zero.
+    const Limb* getLimbs() const {
+        return getData();
+    }
+
     /// @brief Returns the bit in the index given.
     /// @note The index spans from 0 to bits - 1.
     ///
@@ -358,6 +372,11 @@ public:
     unsigned getEffectiveBitWidth(bool isSigned) const;
 };
 
+/// @brief The limbs are either inline or behind a pointer, never pointed to by
+/// the bigint itself.
+template<>
+struct is_trivially_relocatable<bigint> : std::true_type {};
+
 } // namespace inr
 
 #endif // INERTIA_MATH_BIGINT_H
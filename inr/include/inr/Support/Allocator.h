@@ -0,0 +1,125 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_SUPPORT_ALLOCATOR_H
+#define INERTIA_SUPPORT_ALLOCATOR_H
+
+/// @file Support/Allocator.h
+/// @brief Provides a bump pointer allocator.
+
+#include <inr/Support/Assert.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace inr {
+
+/// @brief Bump pointer (arena) allocator.
+/// @note Not thread safe.
+///
+/// Memory is handed out from big slabs by moving a pointer forward, there is
+/// no way to free a single allocation. Everything is released at once when the
+/// allocator is reset or destroyed, which does not run any destructors.
+/// Allocations bigger than half of the slab size get a slab of their own.
+class BumpAllocator {
+public:
+    using size_type = std::size_t;
+
+    /// @brief Default size of one slab in bytes.
+    constexpr static size_type DEFAULT_SLAB_SIZE = 0x4000;
+
+private:
+    /// @brief Header at the start of every slab.
+    struct Slab {
+        Slab* prev_;
+        size_type size_;
+    };
+
+    Slab* slabs_ = nullptr;
+    std::uintptr_t cur_ = 0;
+    std::uintptr_t end_ = 0;
+    size_type slabSize_;
+    size_type bytesAllocated_ = 0;
+    size_type bytesReserved_ = 0;
+    size_type slabCount_ = 0;
+
+    Slab* newSlab(size_type size);
+    void* allocateSlow(size_type size, size_type align);
+
+public:
+    /// @brief Creates an allocator that allocates slabs of `slabSize` bytes.
+    /// @note Does not allocate until the first allocation.
+    BumpAllocator(size_type slabSize = DEFAULT_SLAB_SIZE);
+
+    BumpAllocator(const BumpAllocator&) = delete;
+    BumpAllocator& operator=(const BumpAllocator&) = delete;
+
+    /// @brief Move constructor.
+    BumpAllocator(BumpAllocator&& other) noexcept;
+    /// @brief Move operator.
+    BumpAllocator& operator=(BumpAllocator&& other) noexcept;
+
+    ~BumpAllocator() {
+        reset();
+    }
+
+    /// @brief Allocates `size` bytes aligned to `align`.
+    /// @note `align` must be a power of 2.
+    void* allocate(size_type size, size_type align) {
+        inr_assert(std::has_single_bit(align),
+                   "BumpAllocator allocate(): align must be a power of 2");
+
+        std::uintptr_t ptr = (cur_ + (align - 1)) & ~std::uintptr_t(align - 1);
+        if(cur_ && ptr + size <= end_) [[likely]] {
+            cur_ = ptr + size;
+            bytesAllocated_ += size;
+            return (void*)ptr;
+        }
+        return allocateSlow(size, align);
+    }
+
+    /// @brief Allocates uninitialized memory for `n` objects of type T.
+    template<typename T>
+    T* allocate(size_type n = 1) {
+        return (T*)allocate(sizeof(T) * n, alignof(T));
+    }
+
+    /// @brief Allocates and constructs an object of type T.
+    /// @note The destructor will not be called by the allocator.
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        return new(allocate<T>()) T(std::forward<Args>(args)...);
+    }
+
+    /// @brief Frees every slab at once.
+    /// @note Does not call any destructors.
+    void reset();
+
+    /// @brief Returns the amount of bytes handed out, without padding.
+    size_type getBytesAllocated() const {
+        return bytesAllocated_;
+    }
+
+    /// @brief Returns the amount of bytes held in slabs.
+    size_type getBytesReserved() const {
+        return bytesReserved_;
+    }
+
+    /// @brief Returns the amount of slabs currently allocated.
+    size_type getSlabCount() const {
+        return slabCount_;
+    }
+
+    /// @brief Returns the size of a regular slab.
+    size_type getSlabSize() const {
+        return slabSize_;
+    }
+};
+
+} // namespace inr
+
+#endif // INERTIA_SUPPORT_ALLOCATOR_H
@@ -69,6 +69,15 @@ protected:
     /// @param ptr Pointer to the data.
     /// @param size Size of the data.
     virtual void writeImpl(cbuff_t ptr, size_type size) = 0;
+    /// @brief Writes the buffered `head` followed by `ptr`, used when a large
+    /// write doesn't fit in the buffer.
+    ///
+    /// Streams that can gather should do both in one write.
+    virtual void writeGatherImpl(cbuff_t head, size_type headSize,
+                                 cbuff_t ptr, size_type size) {
+        if(headSize) writeImpl(head, headSize);
+        writeImpl(ptr, size);
+    }
     /// @brief A hook for when flushing the buffer.
     ///
     /// This is usually empty, although for example when using stdio's FILE
@@ -114,6 +123,11 @@ public:
 
     /// @brief Returns how many chars are currently in the buffer.
     size_type getCharsInBuffer() const {
+        return cur_ - start_;
+    }
+
+    /// @brief Returns how many more chars fit in the buffer.
+    size_type getSpaceLeft() const {
         return end_ - cur_;
     }
 
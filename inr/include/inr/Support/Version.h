@@ -12,6 +12,8 @@
 
 namespace inr {
 
+class stream;
+
 class Version {
 public:
     using version_t = uint16_t;
@@ -42,7 +44,7 @@ public:
         return patch_;
     }
 
-    friend class stream& operator<<(stream&, Version);
+    friend stream& operator<<(stream&, Version);
 };
 
 Version getInertiaVersion();
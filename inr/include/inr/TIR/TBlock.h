@@ -17,10 +17,12 @@ namespace inr {
 
 class TBlock : public ilist_node<TBlock> {
     const BlockDef* original_;
-    ilist<TInst> insts_;
+    ilist<TInst, ilist_arena_alloc> insts_;
 
 public:
-    TBlock(const BlockDef* original) : original_(original) {}
+    /// @brief Creates a block whose instructions are allocated from `alloc`.
+    TBlock(const BlockDef* original, ilist_arena_alloc alloc) :
+        original_(original), insts_(alloc) {}
 
     TBlock(const TBlock&) = delete;
     TBlock& operator=(const TBlock&) = delete;
@@ -28,21 +30,17 @@ public:
     TBlock(TBlock&&) noexcept = default;
     TBlock& operator=(TBlock&&) noexcept = default;
 
-    const ilist<TInst>& getInstructions() const {
+    const ilist<TInst, ilist_arena_alloc>& getInstructions() const {
         return insts_;
     }
 
     TInst* addInst(TInst::InstType instType, TIRT type) {
-        return insts_.push_back(new TInst(instType, type));
+        return insts_.emplace_back(instType, type);
     }
 
     const BlockDef* getOriginal() const {
         return original_;
     }
-
-    ~TBlock() {
-        insts_.deleteNodes();
-    }
 };
 
 } // namespace inr
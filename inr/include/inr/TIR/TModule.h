@@ -11,36 +11,54 @@
 #include <inr/ADT/IList.h>
 #include <inr/IR/FuncDef.h>
 #include <inr/IR/TUnit.h>
+#include <inr/Support/Allocator.h>
 #include <inr/TIR/TSymbol.h>
 
+#include <memory>
+#include <utility>
+
 namespace inr {
 
+/// @brief The symbols, blocks and instructions of a module all live in the
+/// module's arena. Destroying the module runs their destructors and drops the
+/// arena's slabs, instead of deleting every node.
 class TModule {
     const TUnit* original_;
-    ilist<TSymbol> symbols_;
+    /// @brief Behind a pointer so the lists' policies stay valid on move.
+    std::unique_ptr<BumpAllocator> allocator_;
+    ilist<TSymbol, ilist_arena_alloc> symbols_;
 
 public:
-    TModule(const TUnit* original) : original_(original) {}
+    TModule(const TUnit* original) :
+        original_(original), allocator_(std::make_unique<BumpAllocator>()),
+        symbols_(*allocator_) {}
 
     TModule(const TModule&) = delete;
     TModule& operator=(const TModule&) = delete;
 
     TModule(TModule&&) noexcept = default;
-    TModule& operator=(TModule&&) noexcept = default;
 
-    ~TModule() {
-        symbols_.deleteNodes();
+    TModule& operator=(TModule&& other) noexcept {
+        if(this != &other) {
+            // The symbols have to go before the arena they live in.
+            symbols_ = std::move(other.symbols_);
+            allocator_ = std::move(other.allocator_);
+            original_ = other.original_;
+        }
+        return *this;
     }
 
+    ~TModule() = default;
+
     TSymbol* addSymbol(const FuncDef* from) {
-        return symbols_.push_back(new TSymbol(from));
+        return symbols_.emplace_back(from, symbols_.getAllocPolicy());
     }
 
     const TUnit* getOriginal() const {
         return original_;
     }
 
-    const ilist<TSymbol>& getSyms() const {
+    const ilist<TSymbol, ilist_arena_alloc>& getSyms() const {
         return symbols_;
     }
 };
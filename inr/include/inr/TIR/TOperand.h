@@ -8,10 +8,12 @@
 /// @file TIR/TOperand.h
 /// @brief Provides a TIR operand class.
 
+#include <inr/ADT/Relocate.h>
 #include <inr/Math/BigInt.h>
 #include <inr/Support/Assert.h>
 
 #include <cstdint>
+#include <type_traits>
 
 namespace inr {
 
@@ -85,6 +87,11 @@ public:
     }
 };
 
+/// @brief Bigint immediates are only pointed to, so operands stay relocatable
+/// even if they stop being trivially copyable.
+template<>
+struct is_trivially_relocatable<TOperand> : std::true_type {};
+
 } // namespace inr
 
 #endif // INERTIA_TIR_TOPERAND_H
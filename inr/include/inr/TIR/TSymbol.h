@@ -17,10 +17,12 @@ namespace inr {
 
 class TSymbol : public ilist_node<TSymbol> {
     const FuncDef* original_;
-    ilist<TBlock> blocks_;
+    ilist<TBlock, ilist_arena_alloc> blocks_;
 
 public:
-    TSymbol(const FuncDef* original) : original_(original) {}
+    /// @brief Creates a symbol whose blocks are allocated from `alloc`.
+    TSymbol(const FuncDef* original, ilist_arena_alloc alloc) :
+        original_(original), blocks_(alloc) {}
 
     TSymbol(const TSymbol&) = delete;
     TSymbol& operator=(const TSymbol&) = delete;
@@ -33,16 +35,12 @@ public:
     }
 
     TBlock* addBlock(const BlockDef* original) {
-        return blocks_.push_back(new TBlock(original));
+        return blocks_.emplace_back(original, blocks_.getAllocPolicy());
     }
 
-    const ilist<TBlock>& getBlocks() const {
+    const ilist<TBlock, ilist_arena_alloc>& getBlocks() const {
         return blocks_;
     }
-
-    ~TSymbol() {
-        blocks_.deleteNodes();
-    }
 };
 
 } // namespace inr
@@ -8,10 +8,10 @@
 /// @file TIR/Translator.h
 /// @brief Translates IR to TIR.
 
-#include <inr/ADT/HMap.h>
 #include <inr/IR/BlockDef.h>
 #include <inr/IR/ConstDef.h>
 #include <inr/IR/Def.h>
+#include <inr/IR/DenseDefMap.h>
 #include <inr/IR/FuncDef.h>
 #include <inr/IR/InstDef.h>
 #include <inr/IR/TUnit.h>
@@ -31,11 +31,22 @@ namespace inr {
 
 class Translator {
 public:
-    using OperandMap = HMap<const Def*, TOperand>;
+    using OperandMap = DenseDefMap<TOperand>;
 
 private:
+    /// @brief Constants and undefs are materialized in every block that uses
+    /// them, so the operand is only valid inside of `block`.
+    struct ConstOperand {
+        TOperand op;
+        const TBlock* block;
+    };
+
     const TargetInfo* tinfo_;
+    /// @brief Operands of the current function's args, blocks and
+    /// instructions.
     OperandMap operandMap_;
+    /// @brief Operands of the constants and undefs.
+    DenseDefMap<ConstOperand> constMap_;
     uint32_t vregN_ = 0;
 
 public:
@@ -0,0 +1,104 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_VFS_CACHINGFS_H
+#define INERTIA_VFS_CACHINGFS_H
+
+/// @file Vfs/CachingFs.h
+/// @brief Provides a filesystem wrapper that caches stat results.
+
+#include <inr/ADT/HMap.h>
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace inr::vfs {
+
+/// @brief Wraps a filesystem and remembers what `stat` returned.
+///
+/// Results are keyed by the normalized path, and paths that don't exist are
+/// remembered too, so probing the same missing path again, be it through
+/// `stat`, `exists`, `open` for reading or `map`, costs no syscall.
+/// Removing, creating, renaming or writing to a file through the wrapper
+/// forgets it and its directory, renaming a directory forgets everything.
+/// Changes made around the wrapper aren't seen, use `invalidate` or `clear`
+/// for those.
+/// @note Paths are normalized without resolving symlinks, so "a/../b" and
+/// "b" share an entry.
+class CachingFilesystem : public Filesystem {
+    Filesystem& fs_;
+
+    mutable std::mutex mutex_;
+    HMap<std::string, FSStat> cache_;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+    /// @brief Bumped by every invalidation, a stat that raced one isn't kept.
+    std::uint64_t generation_ = 0;
+
+    /// @brief Returns true if `key` is cached as missing, counts it as a hit.
+    bool knownMissing(const std::string& key);
+
+    /// @brief Stats `path` on a miss and caches the result under `key`,
+    /// unless the cache was invalidated since `generation` was read.
+    FSStat fetch(std::string_view path, std::string key,
+                 std::uint64_t generation, std::error_code& ec);
+
+    /// @brief Forgets `key` and its directory, the mutex must be held.
+    void forget(const std::string& key);
+
+public:
+    /// @param fs Filesystem to wrap, has to outlive the wrapper.
+    explicit CachingFilesystem(Filesystem& fs) : fs_(fs) {}
+
+    /// @brief Forgets `path` and its directory.
+    void invalidate(std::string_view path);
+
+    /// @brief Forgets everything, keeps the counters.
+    void clear();
+
+    std::size_t getHits() const;
+    std::size_t getMisses() const;
+
+    /// @brief Writes the hit rate and the amount of entries to `os`.
+    void dumpStats(stream& os) const;
+
+    std::unique_ptr<File> open(std::string_view path, OpenMode om,
+                               std::error_code& ec) override;
+
+    std::error_code rm(std::string_view path) override;
+
+    std::error_code mkdir(std::string_view path) override;
+
+    std::error_code rename(std::string_view from,
+                           std::string_view to) override;
+
+    std::unique_ptr<OutputFile> createOutput(std::string_view path,
+                                             std::size_t sizeHint,
+                                             std::error_code& ec) override;
+
+    std::vector<std::string> listDirs(std::string_view path,
+                                      std::error_code& ec) override;
+
+    FSStat stat(std::string_view path, std::error_code& ec) override;
+
+    std::unique_ptr<MappedFile> map(std::string_view path, Advice advice,
+                                    std::error_code& ec) override;
+
+    std::error_code walk(std::string_view path, DirVisitor& visitor) override;
+    using Filesystem::walk;
+
+    bool exists(std::string_view path) override;
+};
+
+} // namespace inr::vfs
+
+#endif // INERTIA_VFS_CACHINGFS_H
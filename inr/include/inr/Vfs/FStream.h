@@ -25,6 +25,13 @@ class vfsstream : public stream {
         file_->write(ptr, size);
     }
 
+    void writeGatherImpl(cbuff_t head, size_type headSize, cbuff_t ptr,
+                         size_type size) override {
+        inr_assert(file_.get() != nullptr, "File handle is nullptr");
+        vfs::ConstIOVec vecs[] = {{head, headSize}, {ptr, size}};
+        file_->writev(vecs);
+    }
+
 public:
     vfsstream(std::unique_ptr<vfs::File> file,
               size_t bufferSize = DEFAULT_BUFFER_SIZE) :
@@ -0,0 +1,80 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_VFS_MEMORYFS_H
+#define INERTIA_VFS_MEMORYFS_H
+
+/// @file Vfs/MemoryFs.h
+/// @brief Provides a filesystem that only lives in memory.
+
+#include <inr/ADT/HMap.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace inr::vfs {
+
+/// @brief Filesystem that keeps every file in a buffer.
+///
+/// Paths are normalized POSIX style paths, relative ones start at "." and
+/// absolute ones at "/", both of which always exist. Reading a file copies
+/// straight out of its buffer, and `map` returns a view of the buffer
+/// itself. Removed files stay alive while they're open or mapped.
+/// @note The table of files is guarded by a mutex, their contents aren't. A
+/// file that is written shouldn't be read from another thread, and writing to
+/// a mapped file is undefined.
+class MemoryFilesystem : public Filesystem {
+public:
+    struct Node;
+
+private:
+    mutable std::mutex mutex_;
+    HMap<std::string, std::shared_ptr<Node>> nodes_;
+    std::uint64_t nextINode_ = 1;
+
+    Node* lookup(const std::string& key) const;
+    std::shared_ptr<Node> create(const std::string& key, FileType ft,
+                                 std::error_code& ec);
+    std::error_code makeDirs(const std::string& key);
+    void detach(const std::string& key);
+
+public:
+    MemoryFilesystem();
+    ~MemoryFilesystem() override;
+
+    MemoryFilesystem(const MemoryFilesystem&) = delete;
+    MemoryFilesystem& operator=(const MemoryFilesystem&) = delete;
+
+    /// @brief Adds or replaces a file, creating its parent directories.
+    std::error_code addFile(std::string_view path, std::string contents);
+
+    std::unique_ptr<File> open(std::string_view path, OpenMode om,
+                               std::error_code& ec) override;
+
+    std::error_code rm(std::string_view path) override;
+
+    std::error_code mkdir(std::string_view path) override;
+
+    /// @brief Moves a file, directories can't be moved.
+    std::error_code rename(std::string_view from,
+                           std::string_view to) override;
+
+    std::vector<std::string> listDirs(std::string_view path,
+                                      std::error_code& ec) override;
+
+    FSStat stat(std::string_view path, std::error_code& ec) override;
+
+    std::unique_ptr<MappedFile> map(std::string_view path, Advice advice,
+                                    std::error_code& ec) override;
+};
+
+} // namespace inr::vfs
+
+#endif // INERTIA_VFS_MEMORYFS_H
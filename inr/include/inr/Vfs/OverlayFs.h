@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_VFS_OVERLAYFS_H
+#define INERTIA_VFS_OVERLAYFS_H
+
+/// @file Vfs/OverlayFs.h
+/// @brief Provides a filesystem that stacks other filesystems.
+
+#include <inr/Vfs/Vfs.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace inr::vfs {
+
+/// @brief Stacks filesystems on top of each other.
+///
+/// Lookups go from the top layer down, the first layer that has the path
+/// wins. Only the top layer is written to, so a `MemoryFilesystem` pushed
+/// over the native one keeps every write in memory. Opening a lower file
+/// for writing copies it up first, unless it's truncated anyway.
+/// @note The lower layers are never modified, removing a file that is only
+/// in them fails with `read_only_file_system`.
+class OverlayFilesystem : public Filesystem {
+    /// @brief Bottom layer first.
+    std::vector<Filesystem*> layers_;
+
+    Filesystem& top() {
+        return *layers_.back();
+    }
+
+    /// @brief Returns the top-most layer that has `path`, nullptr if none.
+    Filesystem* find(std::string_view path, FSStat& st, std::error_code& ec);
+
+    /// @brief Makes sure `path`'s directory is in the top layer.
+    std::error_code makeParent(std::string_view path);
+
+public:
+    /// @param base The bottom layer.
+    explicit OverlayFilesystem(Filesystem& base) : layers_{&base} {}
+
+    /// @brief Pushes a new top layer, it gets all the writes from now on.
+    /// @note The layers aren't owned, they have to outlive the overlay.
+    void pushOverlay(Filesystem& fs) {
+        layers_.push_back(&fs);
+    }
+
+    std::unique_ptr<File> open(std::string_view path, OpenMode om,
+                               std::error_code& ec) override;
+
+    std::error_code rm(std::string_view path) override;
+
+    std::error_code mkdir(std::string_view path) override;
+
+    /// @brief Renames within the top layer, `from` has to be in it.
+    std::error_code rename(std::string_view from,
+                           std::string_view to) override;
+
+    /// @brief Lists the entries of every layer, without duplicates.
+    std::vector<std::string> listDirs(std::string_view path,
+                                      std::error_code& ec) override;
+
+    FSStat stat(std::string_view path, std::error_code& ec) override;
+
+    std::unique_ptr<MappedFile> map(std::string_view path, Advice advice,
+                                    std::error_code& ec) override;
+};
+
+} // namespace inr::vfs
+
+#endif // INERTIA_VFS_OVERLAYFS_H
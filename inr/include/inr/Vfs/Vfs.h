@@ -8,9 +8,11 @@
 /// @file Vfs/Vfs.h
 /// @brief Provides an abstraction over the actual filesystem.
 
+#include <inr/ADT/ArrView.h>
 #include <inr/Vfs/Path.h>
 
 #include <cstddef>
+#include <concepts>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -47,7 +49,22 @@ enum class FileType : unsigned char {
     Socket,          ///< Socket.
 };
 
+/// @brief A buffer to read into, one of many for `File::readv`.
+struct IOVec {
+    void* data;
+    std::size_t size;
+};
+
+/// @brief A buffer to write from, one of many for `File::writev`.
+struct ConstIOVec {
+    const void* data;
+    std::size_t size;
+};
+
 /// @brief Base class for all files.
+///
+/// Only `read`, `write`, `seek` and `tell` have to be implemented, the rest
+/// are built on them by default. Native files do them in one syscall.
 class File {
 public:
     virtual ~File() = default;
@@ -63,6 +80,155 @@ public:
 
     /// @brief Tells the current offset within the file.
     virtual std::size_t tell() const = 0;
+
+    /// @brief Reads into the buffers in order, stops at a short read.
+    /// @return The total amount of bytes read.
+    virtual std::size_t readv(arrview<IOVec> vecs);
+
+    /// @brief Writes the buffers in order, stops at a short write.
+    /// @return The total amount of bytes written.
+    virtual std::size_t writev(arrview<ConstIOVec> vecs);
+
+    /// @brief Reads at `offset` without moving the read/write pointer.
+    /// @note The default seeks there and back, so it isn't safe to share the
+    /// file between threads then.
+    virtual std::size_t pread(void* buffer, std::size_t bytes,
+                              std::size_t offset);
+
+    /// @brief Writes at `offset` without moving the read/write pointer.
+    /// @note The default seeks there and back, so it isn't safe to share the
+    /// file between threads then.
+    virtual std::size_t pwrite(const void* buffer, std::size_t bytes,
+                               std::size_t offset);
+
+    /// @brief Makes sure the written data survives a crash.
+    ///
+    /// The default does nothing, files that aren't on a disk have nothing to
+    /// flush.
+    virtual std::error_code sync() {
+        return {};
+    }
+};
+
+class Filesystem;
+
+/// @brief A file written next to its path, see `Filesystem::createOutput`.
+///
+/// Nothing is at the path until `commit` renames the file over it, so readers
+/// either see the old file or the whole new one. Destroying the file before
+/// it's committed aborts it.
+/// @note Reads and writes do nothing once it's committed or aborted.
+class OutputFile : public File {
+    Filesystem* fs_;
+    std::unique_ptr<File> file_;
+    std::string path_;
+    std::string tempPath_;
+    bool failed_ = false;
+
+public:
+    /// @param fs Filesystem both paths are in.
+    /// @param file The temporary file, open for writing.
+    OutputFile(Filesystem& fs, std::unique_ptr<File> file, std::string path,
+               std::string tempPath);
+    ~OutputFile() override;
+
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+
+    /// @brief Returns the path the file is published at.
+    std::string_view getPath() const {
+        return path_;
+    }
+
+    /// @brief Returns the path the file is written at until then.
+    std::string_view getTempPath() const {
+        return tempPath_;
+    }
+
+    /// @brief Returns false once the file is committed or aborted.
+    bool isOpen() const {
+        return file_ != nullptr;
+    }
+
+    /// @brief Makes `commit` and `abort` go through `fs`, a wrapper of the
+    /// filesystem that created the file.
+    void setFilesystem(Filesystem& fs) {
+        fs_ = &fs;
+    }
+
+    std::size_t read(void* buffer, std::size_t bytes) override;
+    std::size_t write(const void* buffer, std::size_t bytes) override;
+    bool seek(std::size_t offset, SeekType st) override;
+    std::size_t tell() const override;
+    std::size_t readv(arrview<IOVec> vecs) override;
+    std::size_t writev(arrview<ConstIOVec> vecs) override;
+    std::size_t pread(void* buffer, std::size_t bytes,
+                      std::size_t offset) override;
+    std::size_t pwrite(const void* buffer, std::size_t bytes,
+                       std::size_t offset) override;
+    std::error_code sync() override;
+
+    /// @brief Syncs and closes the file and renames it over its path.
+    /// @return The error, the temporary file is removed then. A short write
+    /// fails it with `io_error`, a truncated file is never published.
+    std::error_code commit();
+
+    /// @brief Closes and removes the temporary file.
+    void abort();
+};
+
+/// @brief How a mapped file is going to be read.
+enum class Advice : unsigned char {
+    Normal,     ///< No particular order.
+    Sequential, ///< Front to back, reads ahead aggressively.
+    Random,     ///< Scattered reads, doesn't read ahead.
+};
+
+/// @brief Read-only view of a whole file, valid while the object lives.
+class MappedFile {
+protected:
+    const char* data_;
+    std::size_t size_;
+
+    MappedFile(const char* data, std::size_t size) :
+        data_(data), size_(size) {}
+
+public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    virtual ~MappedFile() = default;
+
+    const char* data() const {
+        return data_;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    const char* begin() const {
+        return data_;
+    }
+
+    const char* end() const {
+        return data_ + size_;
+    }
+
+    /// @brief Returns the contents as a string view.
+    std::string_view str() const {
+        return {data_, size_};
+    }
+
+    /// @brief Returns true if the contents are viewed in place, false if they
+    /// were read into a buffer.
+    virtual bool isMapped() const {
+        return false;
+    }
+
+    /// @brief Changes how the rest of the file is going to be read, does
+    /// nothing if it isn't mapped.
+    virtual void advise(Advice) {}
 };
 
 /// @brief File permissions.
@@ -168,8 +334,66 @@ public:
     }
 };
 
+/// @brief An entry found by `Filesystem::walk`.
+/// @note The views are only valid during the visit.
+class DirEntry {
+    std::string_view path_;
+    std::string_view name_;
+    FileType ft_;
+    unsigned depth_;
+
+public:
+    DirEntry(std::string_view path, std::string_view name, FileType ft,
+             unsigned depth) :
+        path_(path), name_(name), ft_(ft), depth_(depth) {}
+
+    /// @brief Returns the path, starting with the walked directory.
+    std::string_view getPath() const {
+        return path_;
+    }
+
+    /// @brief Returns the name within its directory.
+    std::string_view getName() const {
+        return name_;
+    }
+
+    /// @brief Returns the entry's type, symlinks aren't followed.
+    FileType getFT() const {
+        return ft_;
+    }
+
+    /// @brief Returns how deep it is, the walked directory's entries are 0.
+    unsigned getDepth() const {
+        return depth_;
+    }
+};
+
+/// @brief What a walk does after visiting an entry.
+enum class WalkAction : unsigned char {
+    Continue, ///< Keep going, descend if it's a directory.
+    Skip,     ///< Don't descend into this directory.
+    Stop,     ///< End the walk.
+};
+
+/// @brief Visits the entries found by `Filesystem::walk`.
+class DirVisitor {
+public:
+    virtual ~DirVisitor() = default;
+
+    virtual WalkAction visit(const DirEntry& entry) = 0;
+};
+
 /// @brief Base class for all filesystem abstractions.
 class Filesystem {
+protected:
+    /// @brief Reads the rest of `file` into a buffer, `sizeHint` is the
+    /// expected size but the file may be shorter or longer.
+    static std::unique_ptr<MappedFile> readAll(File& file,
+                                               std::size_t sizeHint);
+
+    /// @brief Returns a new name next to `path` for a temporary file.
+    static std::string tempSibling(std::string_view path);
+
 public:
     virtual ~Filesystem() = default;
 
@@ -188,7 +412,67 @@ public:
 
     virtual FSStat stat(std::string_view path, std::error_code& ec) = 0;
 
-    bool exists(std::string_view path) {
+    /// @brief Maps the file read-only, returns nullptr on error.
+    ///
+    /// The default reads the file into a buffer, filesystems that can map
+    /// files override it. Small files are read too, as mapping them costs
+    /// more than the copy.
+    /// @note Truncating a mapped file while the mapping lives is undefined.
+    virtual std::unique_ptr<MappedFile> map(std::string_view path,
+                                            Advice advice,
+                                            std::error_code& ec);
+
+    /// @brief Moves the file at `from` to `to`, replacing what's there.
+    ///
+    /// The default copies the file and removes `from`, which isn't atomic,
+    /// filesystems that can rename override it. The native one also syncs the
+    /// directory of `to` when it can, so the rename survives a crash.
+    /// @return The error if nothing was moved. Once `to` is in place it
+    /// succeeds, even if `from` couldn't be removed or the directory synced.
+    virtual std::error_code rename(std::string_view from, std::string_view to);
+
+    /// @brief Creates a file that replaces `path` once it's committed,
+    /// returns nullptr on error.
+    ///
+    /// The file is written to a temporary sibling, so renaming it never
+    /// crosses filesystems. `sizeHint` is the expected size, or 0 if it isn't
+    /// known, filesystems that can reserve the space do so up front. The
+    /// default opens the sibling with `open` and ignores the hint. The native
+    /// one gives the file the permissions of the file it replaces. Wrappers
+    /// forward it, see `OutputFile::setFilesystem`.
+    virtual std::unique_ptr<OutputFile>
+    createOutput(std::string_view path, std::size_t sizeHint,
+                 std::error_code& ec);
+
+    /// @brief Walks the tree under `path` depth first, a directory is visited
+    /// before its entries. `path` itself isn't visited.
+    ///
+    /// The default lists every directory and stats every entry, filesystems
+    /// that can tell the type while listing override it. As it goes through
+    /// `stat`, it follows symlinks, but never into a directory it's already
+    /// in.
+    /// @return The error that ended the walk, if any.
+    virtual std::error_code walk(std::string_view path, DirVisitor& visitor);
+
+    /// @brief Walks the tree with a callable taking a `const DirEntry&` and
+    /// returning a `WalkAction`.
+    template<typename Fn>
+        requires std::invocable<Fn&, const DirEntry&>
+    std::error_code walk(std::string_view path, Fn&& fn) {
+        struct FnVisitor : DirVisitor {
+            Fn& fn;
+
+            FnVisitor(Fn& fn) : fn(fn) {}
+
+            WalkAction visit(const DirEntry& entry) override {
+                return fn(entry);
+            }
+        } visitor(fn);
+        return walk(path, static_cast<DirVisitor&>(visitor));
+    }
+
+    /// @brief Returns true if something is at `path`.
+    virtual bool exists(std::string_view path) {
         std::error_code ec;
         auto s = stat(path, ec);
         return !ec && s.getFT() != FileType::NotFound &&
@@ -0,0 +1,623 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/ArrView.h>
+#include <inr/ADT/StringPool.h>
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BinaryFormat.h>
+#include <inr/IR/BinaryReader.h>
+#include <inr/IR/BlockDef.h>
+#include <inr/IR/CallingConv.h>
+#include <inr/IR/DenseDefMap.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/Type.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/UnDef.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Math/FPFormat.h>
+#include <inr/Support/Allocator.h>
+#include <inr/Support/Stream.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace inr {
+
+class BinaryReader::Reader {
+    TUnit& unit_;
+    TypeMap& tm_;
+    stream* os_;
+
+    const std::uint8_t* begin_;
+    const std::uint8_t* cur_;
+    const std::uint8_t* end_;
+    bool failed_ = false;
+
+    std::vector<PooledString> strings_;
+    std::vector<const Type*> types_;
+    std::vector<Def*> globals_;
+
+    /// @brief The functions of the module, in order.
+    std::vector<FuncDef*> funcs_;
+    /// @brief Where the body of every function with one is.
+    DenseDefMap<arrview<std::uint8_t>> bodies_;
+
+    /// @brief Function being read.
+    FuncDef* fn_ = nullptr;
+    /// @brief Args, blocks and instructions of the function being read.
+    /// Instructions used before they are read hold a placeholder undef.
+    std::vector<Def*> locals_;
+    std::uint32_t numPending_ = 0;
+
+    /// @brief Reports the first error, with the offset it was found at.
+    void fail(const char* msg) {
+        if(failed_) return;
+        failed_ = true;
+        end_ = cur_;
+        if(os_) {
+            (((*os_) << "ir reader: ").changeColor(col::RED, true) << "error: ")
+                .resetColor();
+            (*os_) << msg << " at offset " << std::size_t(cur_ - begin_)
+                   << '\n';
+        }
+    }
+
+    std::size_t remaining() const {
+        return std::size_t(end_ - cur_);
+    }
+
+    std::uint8_t byte() {
+        if(cur_ == end_) [[unlikely]] {
+            fail("unexpected end of data");
+            return 0;
+        }
+        return *cur_++;
+    }
+
+    std::uint64_t varint() {
+        if(cur_ != end_ && *cur_ < 0x80) [[likely]] {
+            return *cur_++;
+        }
+
+        std::uint64_t v = 0;
+        for(unsigned shift = 0; shift < 64; shift += 7) {
+            if(cur_ == end_) break;
+            std::uint8_t b = *cur_++;
+            v |= std::uint64_t(b & 0x7F) << shift;
+            if(!(b & 0x80)) return v;
+        }
+        fail("truncated varint");
+        return 0;
+    }
+
+    /// @brief Reads a count of items that take at least `minBytes` each, so
+    /// corrupt counts can't make the reader allocate much.
+    std::uint32_t count(std::size_t minBytes) {
+        std::uint64_t n = varint();
+        if(n > remaining() / minBytes) {
+            fail("count is larger than the data");
+            return 0;
+        }
+        return std::uint32_t(n);
+    }
+
+    PooledString name() {
+        std::uint64_t n = varint();
+        if(n > strings_.size()) {
+            fail("string index out of bounds");
+            return {};
+        }
+        return n ? strings_[n - 1] : PooledString();
+    }
+
+    const Type* type() {
+        std::uint64_t n = varint();
+        if(n >= types_.size()) {
+            fail("type index out of bounds");
+            return nullptr;
+        }
+        return types_[n];
+    }
+
+    template<typename T>
+    T enumByte(T last, const char* msg) {
+        std::uint8_t b = byte();
+        if(b > std::uint8_t(last)) {
+            fail(msg);
+            return T(0);
+        }
+        return T(b);
+    }
+
+    bool readHeader() {
+        if(remaining() < sizeof(IR_BINARY_MAGIC) ||
+           std::memcmp(cur_, IR_BINARY_MAGIC, sizeof(IR_BINARY_MAGIC)) != 0) {
+            fail("not a binary IR module");
+            return false;
+        }
+        cur_ += sizeof(IR_BINARY_MAGIC);
+        if(varint() != IR_BINARY_VERSION) fail("unsupported version");
+        return !failed_;
+    }
+
+    bool readStrings() {
+        std::uint32_t n = count(1);
+        strings_.reserve(n);
+        for(std::uint32_t i = 0; i < n && !failed_; i++) {
+            std::uint64_t size = varint();
+            if(size > remaining()) {
+                fail("string is larger than the data");
+                break;
+            }
+            strings_.push_back(unit_.getNames().intern(
+                std::string_view((const char*)cur_, size)));
+            cur_ += size;
+        }
+        return !failed_;
+    }
+
+    const Type* readType() {
+        switch(enumByte(Type::Function, "unknown type")) {
+            case Type::Integer: {
+                std::uint64_t width = varint();
+                if(width == 0 || width > UINT32_MAX) {
+                    fail("invalid integer width");
+                    return nullptr;
+                }
+                return tm_.getInt(unsigned(width));
+            }
+            case Type::Pointer:
+                return tm_.getPtr();
+            case Type::Void:
+                return tm_.getVoid();
+            case Type::Block:
+                return tm_.getBlock();
+            case Type::Float:
+                return tm_.getFloat(
+                    enumByte(FPFormat::x87_80, "unknown float format"));
+            case Type::Function: {
+                const Type* ret = type();
+                bool vararg = byte();
+                std::uint32_t n = count(1);
+                std::vector<const Type*> args(n);
+                for(const Type*& arg : args) arg = type();
+                if(failed_) return nullptr;
+                return tm_.getFunc(ret, args, vararg);
+            }
+        }
+        return nullptr;
+    }
+
+    bool readTypes() {
+        std::uint32_t n = count(1);
+        types_.reserve(n);
+        for(std::uint32_t i = 0; i < n && !failed_; i++) {
+            types_.push_back(readType());
+        }
+        return !failed_;
+    }
+
+    bool readConsts() {
+        std::uint32_t n = count(2);
+        globals_.reserve(globals_.size() + n);
+        std::vector<bigint::Limb> limbs;
+        for(std::uint32_t i = 0; i < n && !failed_; i++) {
+            const Type* t = type();
+            if(failed_) break;
+            if(!t->isInteger()) {
+                fail("constant is not an integer");
+                break;
+            }
+
+            const IntType* it = (const IntType*)t;
+            unsigned width = it->getWidth();
+            if(width <= bigint::LIMB_BITS) {
+                globals_.push_back(unit_.createConst(it, varint()));
+                continue;
+            }
+
+            std::size_t numLimbs = (width - 1) / bigint::LIMB_BITS + 1;
+            if(numLimbs > remaining()) {
+                fail("constant is larger than the data");
+                break;
+            }
+            limbs.resize(numLimbs);
+            for(bigint::Limb& limb : limbs) limb = varint();
+            globals_.push_back(
+                unit_.createConst(it, bigint::fromLimbs(width, limbs.data())));
+        }
+
+        n = count(1);
+        for(std::uint32_t i = 0; i < n && !failed_; i++) {
+            const Type* t = type();
+            if(t) globals_.push_back(unit_.createUndef(t));
+        }
+        return !failed_;
+    }
+
+    /// @brief Reads the index, and remembers where the bodies are.
+    bool readFuncs() {
+        std::uint32_t n = count(6);
+        funcs_.reserve(n);
+        std::vector<std::uint64_t> sizes;
+        sizes.reserve(n);
+        std::uint64_t total = 0;
+
+        for(std::uint32_t i = 0; i < n && !failed_; i++) {
+            PooledString fnName = name();
+            const Type* t = type();
+            Linkage linkage = enumByte(Linkage::Weak, "unknown linkage");
+            TypeExt ext = enumByte(TypeExt::ZeroExt, "unknown extension");
+            std::uint64_t cc = varint();
+            if(failed_) break;
+            if(!t->isFunction()) {
+                fail("function type expected");
+                break;
+            }
+            if(cc > unsigned(CallingConv::SystemV)) {
+                fail("unknown calling convention");
+                break;
+            }
+
+            FuncDef* fn =
+                unit_.createFunction((const FuncType*)t, {}, linkage, ext);
+            fn->setName(fnName);
+            fn->setCC(CallingConv(cc));
+            for(unsigned a = 0; a < fn->getNumArgs() && !failed_; a++) {
+                ArgDef* arg = fn->getArg(a);
+                arg->setName(name());
+                arg->setExt(enumByte(TypeExt::ZeroExt, "unknown extension"));
+            }
+
+            std::uint64_t size = varint();
+            total += size;
+            if(size > remaining() || total > remaining()) {
+                fail("function body is larger than the data");
+                break;
+            }
+            sizes.push_back(size);
+            funcs_.push_back(fn);
+        }
+        if(failed_) return false;
+        if(total != remaining()) {
+            fail("function bodies don't match the size of the data");
+            return false;
+        }
+
+        // Functions come first in the global numbering.
+        globals_.insert(globals_.begin(), funcs_.begin(), funcs_.end());
+
+        bodies_.reset(unit_);
+        for(std::size_t i = 0; i < funcs_.size(); i++) {
+            if(sizes[i]) bodies_.try_emplace(funcs_[i], cur_, sizes[i]);
+            cur_ += sizes[i];
+        }
+        return true;
+    }
+
+    Def* operand(std::uint32_t cur) {
+        std::uint64_t v = varint();
+        std::uint64_t n = v >> IR_BINARY_OPERAND_BITS;
+        switch(OperandKind(v & ((1 << IR_BINARY_OPERAND_BITS) - 1))) {
+            case OperandKind::Back:
+                if(n == 0 || n > cur) break;
+                return locals_[cur - n];
+            case OperandKind::Global:
+                if(n >= globals_.size()) break;
+                return globals_[n];
+            case OperandKind::Forward: {
+                const Type* t = type();
+                if(failed_ || n >= locals_.size() - cur) break;
+
+                Def*& local = locals_[cur + n];
+                if(!local) {
+                    local = fn_->getAllocator().create<UnDef>(t);
+                    numPending_++;
+                }
+                if(local->getType() != t) {
+                    fail("forward reference type mismatch");
+                    return nullptr;
+                }
+                return local;
+            }
+        }
+        fail("operand out of bounds");
+        return nullptr;
+    }
+
+    BlockDef* blockOperand(std::uint32_t cur) {
+        Def* def = operand(cur);
+        if(!def) return nullptr;
+        if(def->getDefType() != Def::BlockDefType) {
+            fail("block operand expected");
+            return nullptr;
+        }
+        return (BlockDef*)def;
+    }
+
+    /// @brief Makes `inst` local `cur`, replacing the placeholder if it was
+    /// used before.
+    void define(std::uint32_t cur, InstDef* inst, PooledString instName) {
+        inst->setName(instName);
+        Def*& local = locals_[cur];
+        if(local) {
+            if(local->getType() != inst->getType()) {
+                fail("forward reference type mismatch");
+                return;
+            }
+            local->replaceAllUsesWith(inst);
+            numPending_--;
+        }
+        local = inst;
+    }
+
+    InstDef* createBinary(InstDef::InstType op, BlockDef* blk, Def* lhs,
+                          Def* rhs) {
+        switch(op) {
+            case InstDef::Add:
+                return AddInst::createAdd(blk, lhs, rhs);
+            case InstDef::Sub:
+                return SubInst::createSub(blk, lhs, rhs);
+            case InstDef::Mul:
+                return MulInst::createMul(blk, lhs, rhs);
+            case InstDef::UDiv:
+                return UDivInst::createUDiv(blk, lhs, rhs);
+            case InstDef::SDiv:
+                return SDivInst::createSDiv(blk, lhs, rhs);
+            case InstDef::URem:
+                return URemInst::createURem(blk, lhs, rhs);
+            case InstDef::SRem:
+                return SRemInst::createSRem(blk, lhs, rhs);
+            case InstDef::Shl:
+                return ShlInst::createShl(blk, lhs, rhs);
+            case InstDef::LShr:
+                return LShrInst::createLShr(blk, lhs, rhs);
+            case InstDef::AShr:
+                return AShrInst::createAShr(blk, lhs, rhs);
+            case InstDef::And:
+                return AndInst::createAnd(blk, lhs, rhs);
+            case InstDef::Or:
+                return OrInst::createOr(blk, lhs, rhs);
+            case InstDef::Xor:
+                return XorInst::createXor(blk, lhs, rhs);
+            default:
+                return nullptr;
+        }
+    }
+
+    bool readInst(BlockDef* blk, std::uint32_t cur) {
+        auto op = enumByte(InstDef::Alloca, "unknown instruction");
+        if(failed_) return false;
+
+        PooledString instName;
+        InstDef* inst = nullptr;
+        switch(op) {
+            case InstDef::Ret: {
+                std::uint64_t n = varint();
+                Def* val = n == 1 ? operand(cur) : nullptr;
+                if(n > 1) fail("invalid return");
+                if(failed_) return false;
+                inst = RetInst::createRet(tm_, blk, val);
+            } break;
+            case InstDef::Jmp: {
+                std::uint64_t n = varint();
+                if(n != 1 && n != 3) {
+                    fail("invalid jump");
+                    return false;
+                }
+                Def* ops[3];
+                for(std::uint64_t i = 0; i < n; i++) ops[i] = operand(cur);
+                if(failed_) return false;
+                inst = n == 1 ? JmpInst::createJmp(tm_, blk, ops[0])
+                              : JmpInst::createJmpCond(tm_, blk, ops[0],
+                                                       ops[1], ops[2]);
+            } break;
+            case InstDef::Unreachable:
+                inst = UnreachableInst::createUnreachable(tm_, blk);
+                break;
+            case InstDef::Cmp: {
+                instName = name();
+                std::uint64_t cond = varint();
+                Def* lhs = operand(cur);
+                Def* rhs = operand(cur);
+                if(cond > CmpInst::SLessEqual) fail("unknown comparison");
+                if(failed_) return false;
+                inst = CmpInst::createCmp(tm_, blk, CmpInst::CmpCond(cond),
+                                          lhs, rhs);
+            } break;
+            case InstDef::Phi: {
+                instName = name();
+                const Type* t = type();
+                std::uint32_t n = count(2);
+                if(failed_) return false;
+
+                // Created first, the incoming values may refer to it.
+                PhiInst* phi = PhiInst::createPhi(blk, t);
+                define(cur, phi, instName);
+                for(std::uint32_t i = 0; i < n; i++) {
+                    Def* val = operand(cur);
+                    BlockDef* from = blockOperand(cur);
+                    if(failed_) return false;
+                    phi->addIncoming(val, from);
+                }
+                return !failed_;
+            }
+            case InstDef::Load: {
+                instName = name();
+                const Type* t = type();
+                Def* from = operand(cur);
+                if(failed_) return false;
+                inst = LoadInst::createLoad(blk, t, from);
+            } break;
+            case InstDef::Store: {
+                Def* to = operand(cur);
+                Def* from = operand(cur);
+                if(failed_) return false;
+                inst = StoreInst::createStore(tm_, blk, to, from);
+            } break;
+            case InstDef::Alloca: {
+                instName = name();
+                const Type* t = type();
+                Def* num = operand(cur);
+                if(failed_) return false;
+                inst = AllocaInst::createAlloca(tm_, blk, t, num);
+            } break;
+            default: {
+                instName = name();
+                Def* lhs = operand(cur);
+                Def* rhs = operand(cur);
+                if(failed_) return false;
+                inst = createBinary(op, blk, lhs, rhs);
+            } break;
+        }
+
+        define(cur, inst, instName);
+        return !failed_;
+    }
+
+    bool readBody(FuncDef& fn, arrview<std::uint8_t> body) {
+        fn_ = &fn;
+        cur_ = body.data();
+        const std::uint8_t* after = cur_ + body.size();
+        end_ = after;
+
+        std::uint32_t numBlocks = count(2);
+        std::uint32_t numInsts = count(1);
+        if(failed_) return false;
+
+        std::uint32_t numArgs = fn.getNumArgs();
+        locals_.assign(numArgs + numBlocks + numInsts, nullptr);
+        numPending_ = 0;
+        for(std::uint32_t i = 0; i < numArgs; i++) {
+            locals_[i] = fn.getArg(i);
+        }
+
+        std::vector<BlockDef*> blocks(numBlocks);
+        for(std::uint32_t i = 0; i < numBlocks; i++) {
+            blocks[i] = unit_.createBlock(tm_, &fn, {});
+            blocks[i]->setName(name());
+            locals_[numArgs + i] = blocks[i];
+        }
+
+        std::uint32_t cur = numArgs + numBlocks;
+        std::uint32_t last = cur + numInsts;
+        for(BlockDef* blk : blocks) {
+            std::uint32_t n = count(1);
+            if(failed_) return false;
+            if(n > last - cur) {
+                fail("more instructions than declared");
+                return false;
+            }
+            for(std::uint32_t i = 0; i < n; i++) {
+                if(!readInst(blk, cur++)) return false;
+            }
+        }
+
+        if(cur != last || cur_ != after) {
+            fail("function body size mismatch");
+            return false;
+        }
+        if(numPending_) {
+            fail("reference to an undefined instruction");
+            return false;
+        }
+        return true;
+    }
+
+public:
+    Reader(TUnit& unit, TypeMap& tm, arrview<std::uint8_t> data, stream* os) :
+        unit_(unit),
+        tm_(tm),
+        os_(os),
+        begin_(data.data()),
+        cur_(data.data()),
+        end_(data.data() + data.size()) {}
+
+    bool open() {
+        return readHeader() && readStrings() && readTypes() && readConsts() &&
+               readFuncs();
+    }
+
+    arrview<FuncDef*> getFuncs() const {
+        return {funcs_.data(), funcs_.size()};
+    }
+
+    /// @brief Returns the body of `fn`, empty if it has none or isn't from
+    /// this module.
+    arrview<std::uint8_t> getBody(const FuncDef& fn) const {
+        if(fn.getParent() != &unit_) return {};
+        const arrview<std::uint8_t>* body = bodies_.find(&fn);
+        return body ? *body : arrview<std::uint8_t>();
+    }
+
+    bool materialize(FuncDef& fn) {
+        arrview<std::uint8_t> body = getBody(fn);
+        if(failed_ || body.empty()) return false;
+        return readBody(fn, body);
+    }
+};
+
+BinaryReader::BinaryReader(TUnit& unit, TypeMap& tm,
+                           arrview<std::uint8_t> data, stream* os) :
+    unit_(unit), reader_(std::make_unique<Reader>(unit, tm, data, os)) {}
+
+BinaryReader::~BinaryReader() {
+    // Whatever wasn't materialized can't be anymore, it stays a declaration.
+    for(FuncDef* fn : reader_->getFuncs()) {
+        if(fn->isMaterializable()) fn->setMaterializable(false);
+    }
+    if(unit_.getMaterializer() == this) unit_.setMaterializer(nullptr);
+}
+
+bool BinaryReader::open() {
+    if(!reader_->open()) return false;
+
+    unit_.setMaterializer(this);
+    for(FuncDef* fn : reader_->getFuncs()) {
+        std::size_t size = reader_->getBody(*fn).size();
+        if(!size) continue;
+        // In memory instructions take about 16 times their encoded size.
+        fn->useOwnAllocator(std::bit_ceil(std::clamp<std::size_t>(
+            size * 16, 1024, BumpAllocator::DEFAULT_SLAB_SIZE)));
+        fn->setMaterializable();
+    }
+    return true;
+}
+
+bool BinaryReader::materialize(FuncDef& fn) {
+    return reader_->materialize(fn);
+}
+
+bool BinaryReader::materializeAll() {
+    for(FuncDef* fn : reader_->getFuncs()) {
+        if(!fn->materialize()) return false;
+    }
+    return true;
+}
+
+void BinaryReader::release(FuncDef& fn) {
+    if(fn.isMaterializable()) return;
+    fn.releaseBody();
+    if(!reader_->getBody(fn).empty()) fn.setMaterializable();
+}
+
+bool BinaryReader::read(TUnit& unit, TypeMap& tm, arrview<std::uint8_t> data,
+                        stream* os) {
+    Reader reader(unit, tm, data, os);
+    if(!reader.open()) return false;
+    for(FuncDef* fn : reader.getFuncs()) {
+        if(reader.getBody(*fn).empty()) continue;
+        if(!reader.materialize(*fn)) return false;
+    }
+    return true;
+}
+
+} // namespace inr
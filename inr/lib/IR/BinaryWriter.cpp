@@ -0,0 +1,356 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/StringPool.h>
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BinaryFormat.h>
+#include <inr/IR/BinaryWriter.h>
+#include <inr/IR/BlockDef.h>
+#include <inr/IR/ConstDef.h>
+#include <inr/IR/DenseDefMap.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/Type.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace inr {
+
+namespace {
+
+void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t v) {
+    while(v >= 0x80) {
+        out.push_back(std::uint8_t(v) | 0x80);
+        v >>= 7;
+    }
+    out.push_back(std::uint8_t(v));
+}
+
+class Writer {
+    const TUnit& unit_;
+    std::vector<std::uint8_t>& out_;
+    /// @brief Bodies of every function, they go after the index.
+    std::vector<std::uint8_t> body_;
+
+    HMap<const Type*, std::uint32_t> typeIds_;
+    std::vector<const Type*> types_;
+    HMap<PooledString, std::uint32_t> stringIds_;
+    std::vector<PooledString> strings_;
+
+    /// @brief Index of a function, or of a constant or undef in their table.
+    DenseDefMap<std::uint32_t> globals_;
+    std::vector<const ConstDef*> consts_;
+    std::vector<const UnDef*> undefs_;
+    std::uint32_t numFuncs_ = 0;
+
+    /// @brief Local numbers of the function being written.
+    DenseDefMap<std::uint32_t> locals_;
+    /// @brief Amount of instructions in each block of the function.
+    std::vector<std::uint32_t> blockSizes_;
+
+    void addType(const Type* t) {
+        if(typeIds_.find(t)) return;
+        if(t->isFunction()) {
+            const FuncType* ft = (const FuncType*)t;
+            addType(ft->getReturn());
+            for(unsigned i = 0; i < ft->getNumArgs(); i++) {
+                addType(ft->getArg(i));
+            }
+        }
+        typeIds_.try_emplace(t, std::uint32_t(types_.size()));
+        types_.push_back(t);
+    }
+
+    void addString(PooledString s) {
+        if(s.empty()) return;
+        auto [id, emplaced] =
+            stringIds_.try_emplace(s, std::uint32_t(strings_.size() + 1));
+        if(emplaced) strings_.push_back(s);
+    }
+
+    void addOperand(const Def* def) {
+        switch(def->getDefType()) {
+            case Def::ConstDefType:
+                if(globals_.try_emplace(def, consts_.size()).second) {
+                    consts_.push_back((const ConstDef*)def);
+                    addType(def->getType());
+                }
+                break;
+            case Def::UnDefDefType:
+                if(globals_.try_emplace(def, undefs_.size()).second) {
+                    undefs_.push_back((const UnDef*)def);
+                    addType(def->getType());
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    /// @brief Collects the types, names, constants and undefs of the unit.
+    void collect() {
+        for(const FuncDef& fn : unit_.getFuncs()) {
+            globals_.try_emplace(&fn, numFuncs_++);
+            addString(fn.getPooledName());
+            addType(fn.getType());
+            for(unsigned i = 0; i < fn.getNumArgs(); i++) {
+                addString(fn.getArg(i)->getPooledName());
+            }
+
+            for(const BlockDef& blk : fn.getBlocks()) {
+                addString(blk.getPooledName());
+                for(const InstDef& inst : blk.getInstructions()) {
+                    addString(inst.getPooledName());
+                    addType(inst.getType());
+                    if(inst.getInstType() == InstDef::Alloca) {
+                        addType(((const AllocaInst&)inst).getAllocaType());
+                    }
+                    for(const Def* op : inst.getUses()) addOperand(op);
+                }
+            }
+        }
+    }
+
+    std::uint32_t stringId(PooledString s) const {
+        return s.empty() ? 0 : *stringIds_.find(s);
+    }
+
+    std::uint32_t typeId(const Type* t) const {
+        return *typeIds_.find(t);
+    }
+
+    std::uint32_t globalId(const Def* def) const {
+        std::uint32_t n = *globals_.find(def);
+        switch(def->getDefType()) {
+            case Def::FuncDefType:
+                return n;
+            case Def::ConstDefType:
+                return numFuncs_ + n;
+            default:
+                return numFuncs_ + std::uint32_t(consts_.size()) + n;
+        }
+    }
+
+    void writeHeader() {
+        out_.insert(out_.end(), IR_BINARY_MAGIC,
+                    IR_BINARY_MAGIC + sizeof(IR_BINARY_MAGIC));
+        writeVarint(out_, IR_BINARY_VERSION);
+    }
+
+    void writeStrings() {
+        writeVarint(out_, strings_.size());
+        for(PooledString s : strings_) {
+            writeVarint(out_, s.size());
+            out_.insert(out_.end(), s.str().begin(), s.str().end());
+        }
+    }
+
+    void writeTypes() {
+        writeVarint(out_, types_.size());
+        for(const Type* t : types_) {
+            out_.push_back(std::uint8_t(t->getID()));
+            switch(t->getID()) {
+                case Type::Integer:
+                    writeVarint(out_, ((const IntType*)t)->getWidth());
+                    break;
+                case Type::Float:
+                    out_.push_back(
+                        std::uint8_t(((const FPType*)t)->getFormat()));
+                    break;
+                case Type::Function: {
+                    const FuncType* ft = (const FuncType*)t;
+                    writeVarint(out_, typeId(ft->getReturn()));
+                    out_.push_back(ft->isVararg());
+                    writeVarint(out_, ft->getNumArgs());
+                    for(unsigned i = 0; i < ft->getNumArgs(); i++) {
+                        writeVarint(out_, typeId(ft->getArg(i)));
+                    }
+                } break;
+                case Type::Pointer:
+                case Type::Void:
+                case Type::Block:
+                    break;
+            }
+        }
+    }
+
+    void writeConsts() {
+        writeVarint(out_, consts_.size());
+        for(const ConstDef* c : consts_) {
+            writeVarint(out_, typeId(c->getType()));
+            const bigint& val = c->getInteger();
+            for(unsigned i = 0; i < val.getLimbCount(); i++) {
+                writeVarint(out_, val.getLimbs()[i]);
+            }
+        }
+
+        writeVarint(out_, undefs_.size());
+        for(const UnDef* u : undefs_) {
+            writeVarint(out_, typeId(u->getType()));
+        }
+    }
+
+    void writeOperand(const Def* def, std::uint32_t cur) {
+        std::uint64_t n;
+        OperandKind kind;
+        if(def->isUnitLevel()) {
+            n = globalId(def);
+            kind = OperandKind::Global;
+        }
+        else {
+            const std::uint32_t* local = locals_.find(def);
+            inr_assert(local, "BinaryWriter write(): operand from another "
+                              "function");
+            if(*local < cur) {
+                n = cur - *local;
+                kind = OperandKind::Back;
+            }
+            else {
+                n = *local - cur;
+                kind = OperandKind::Forward;
+            }
+        }
+
+        writeVarint(body_, (n << IR_BINARY_OPERAND_BITS) | std::uint64_t(kind));
+        if(kind == OperandKind::Forward) {
+            writeVarint(body_, typeId(def->getType()));
+        }
+    }
+
+    void writeInst(const InstDef& inst, std::uint32_t cur) {
+        InstDef::InstType op = inst.getInstType();
+        body_.push_back(std::uint8_t(op));
+
+        switch(op) {
+            case InstDef::Ret:
+            case InstDef::Jmp:
+                writeVarint(body_, inst.getUses().size());
+                break;
+            case InstDef::Unreachable:
+            case InstDef::Store:
+                break;
+            case InstDef::Cmp:
+                writeVarint(body_, stringId(inst.getPooledName()));
+                writeVarint(body_, ((const CmpInst&)inst).getCond());
+                break;
+            case InstDef::Phi:
+                writeVarint(body_, stringId(inst.getPooledName()));
+                writeVarint(body_, typeId(inst.getType()));
+                writeVarint(body_, inst.getUses().size());
+                break;
+            case InstDef::Load:
+                writeVarint(body_, stringId(inst.getPooledName()));
+                writeVarint(body_, typeId(inst.getType()));
+                break;
+            case InstDef::Alloca:
+                writeVarint(body_, stringId(inst.getPooledName()));
+                writeVarint(
+                    body_,
+                    typeId(((const AllocaInst&)inst).getAllocaType()));
+                break;
+            default:
+                // Binary instructions.
+                writeVarint(body_, stringId(inst.getPooledName()));
+                break;
+        }
+
+        if(op == InstDef::Phi) {
+            const PhiInst& phi = (const PhiInst&)inst;
+            for(unsigned i = 0; i < phi.getIncomingCount(); i++) {
+                auto [val, from] = phi.getIncoming(i);
+                writeOperand(val, cur);
+                writeOperand(from, cur);
+            }
+            return;
+        }
+
+        for(const Def* use : inst.getUses()) writeOperand(use, cur);
+    }
+
+    void writeBody(const FuncDef& fn) {
+        if(fn.getBlocks().empty()) return;
+
+        // Number everything first, operands can refer to later instructions.
+        locals_.reset(fn);
+        std::uint32_t next = 0;
+        for(unsigned i = 0; i < fn.getNumArgs(); i++) {
+            locals_.try_emplace(fn.getArg(i), next++);
+        }
+        std::uint32_t numBlocks = 0;
+        for(const BlockDef& blk : fn.getBlocks()) {
+            locals_.try_emplace(&blk, next++);
+            numBlocks++;
+        }
+        std::uint32_t firstInst = next;
+        blockSizes_.clear();
+        for(const BlockDef& blk : fn.getBlocks()) {
+            std::uint32_t first = next;
+            for(const InstDef& inst : blk.getInstructions()) {
+                locals_.try_emplace(&inst, next++);
+            }
+            blockSizes_.push_back(next - first);
+        }
+
+        writeVarint(body_, numBlocks);
+        writeVarint(body_, next - firstInst);
+        for(const BlockDef& blk : fn.getBlocks()) {
+            writeVarint(body_, stringId(blk.getPooledName()));
+        }
+
+        std::uint32_t cur = firstInst;
+        const std::uint32_t* size = blockSizes_.data();
+        for(const BlockDef& blk : fn.getBlocks()) {
+            writeVarint(body_, *size++);
+            for(const InstDef& inst : blk.getInstructions()) {
+                writeInst(inst, cur++);
+            }
+        }
+    }
+
+    void writeFuncs() {
+        writeVarint(out_, numFuncs_);
+        for(const FuncDef& fn : unit_.getFuncs()) {
+            writeVarint(out_, stringId(fn.getPooledName()));
+            writeVarint(out_, typeId(fn.getType()));
+            out_.push_back(std::uint8_t(fn.getLinkage()));
+            out_.push_back(std::uint8_t(fn.getRetExt()));
+            writeVarint(out_, unsigned(fn.getCC()));
+            for(unsigned i = 0; i < fn.getNumArgs(); i++) {
+                const ArgDef* arg = fn.getArg(i);
+                writeVarint(out_, stringId(arg->getPooledName()));
+                out_.push_back(std::uint8_t(arg->getExt()));
+            }
+
+            std::size_t start = body_.size();
+            writeBody(fn);
+            writeVarint(out_, body_.size() - start);
+        }
+        out_.insert(out_.end(), body_.begin(), body_.end());
+    }
+
+public:
+    Writer(const TUnit& unit, std::vector<std::uint8_t>& out) :
+        unit_(unit), out_(out), globals_(unit) {}
+
+    void write() {
+        collect();
+        writeHeader();
+        writeStrings();
+        writeTypes();
+        writeConsts();
+        writeFuncs();
+    }
+};
+
+} // namespace
+
+void BinaryWriter::write(const TUnit& unit, std::vector<std::uint8_t>& out) {
+    Writer(unit, out).write();
+}
+
+} // namespace inr
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BlockDef.h>
+#include <inr/IR/Def.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/TUnit.h>
+#include <inr/Support/Assert.h>
+
+namespace inr {
+
+/// @brief Returns the unit `def` belongs to, nullptr if it can't be reached.
+static TUnit* findUnit(Def* def) {
+    switch(def->getDefType()) {
+        case Def::FuncDefType:
+            return static_cast<FuncDef*>(def)->getParent();
+        case Def::BlockDefType:
+            return static_cast<BlockDef*>(def)->getParent()->getParent();
+        case Def::ArgDefType:
+            return static_cast<ArgDef*>(def)->getParent()->getParent();
+        case Def::InstDefType:
+            if(BlockDef* blk = static_cast<InstDef*>(def)->getParent()) {
+                return blk->getParent()->getParent();
+            }
+            return nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+void Def::setName(std::string_view name) {
+    TUnit* unit = findUnit(this);
+    inr_assert(unit != nullptr, "Def setName(): def has no unit to intern in");
+    if(unit) name_ = unit->getNames().intern(name);
+}
+
+} // namespace inr
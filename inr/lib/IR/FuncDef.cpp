@@ -1,13 +1,84 @@
 // Copyright (c) 2026 Inertia Project
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/ArgDef.h>
 #include <inr/IR/BlockDef.h>
 #include <inr/IR/FuncDef.h>
+#include <inr/IR/Materializer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <new>
 
 namespace inr {
 
+FuncDef::FuncDef(TUnit* parent, const FuncType* type, PooledString name,
+                 Linkage linkage, TypeExt retExt) :
+    GlobalDef(linkage, type, FuncDefType, name),
+    parent_(parent),
+    alloc_(&parent->getAllocator()),
+    numArgs_(type->getNumArgs()),
+    ext_(retExt) {
+    if(numArgs_) {
+        args_ = parent_->getAllocator().allocate<ArgDef>(numArgs_);
+        for(unsigned i = 0; i < numArgs_; i++) {
+            new(args_ + i) ArgDef(this, type->getArg(i), PooledString{}, i,
+                                  TypeExt::NoExt);
+            assignSlot(args_ + i);
+        }
+    }
+}
+
 BlockDef* FuncDef::createBlock(const BlockType* bt, std::string_view name) {
-    return blocks_.push_back(new BlockDef(bt, name));
+    // Appending to a lazy body needs the rest of it first.
+    materialize();
+    auto blk = new(alloc_->allocate<BlockDef>())
+        BlockDef(this, bt, parent_->getNames().intern(name));
+    assignSlot(blk);
+    return blocks_.push_back(blk);
+}
+
+bool FuncDef::materializeSlow() {
+    Materializer* materializer = parent_->getMaterializer();
+    inr_assert(materializer, "FuncDef materialize(): lazy function without a "
+                             "materializer");
+    // Cleared first, the materializer builds the body through the blocks.
+    lazy_ = false;
+    if(materializer->materialize(*this)) return true;
+    releaseBody();
+    return false;
+}
+
+void FuncDef::useOwnAllocator(std::size_t slabSize) {
+    inr_assert(blocks_.empty(),
+               "FuncDef useOwnAllocator(): function has a body");
+    if(alloc_ == &parent_->getAllocator()) {
+        alloc_ = parent_->createBodyAllocator(slabSize);
+    }
+}
+
+void FuncDef::releaseBody() {
+    // Defs the body uses, like constants, keep a list of their users.
+    for(BlockDef& blk : blocks_) {
+        for(InstDef& inst : blk.getInstructions()) inst.removeUses();
+    }
+    blocks_.clear();
+    numSlots_ = numArgs_;
+    if(alloc_ != &parent_->getAllocator()) alloc_->reset();
+}
+
+void FuncDef::renumber() {
+    numSlots_ = 0;
+    for(unsigned i = 0; i < numArgs_; i++) {
+        assignSlot(args_ + i);
+    }
+    for(BlockDef& blk : blocks_) {
+        assignSlot(&blk);
+        for(InstDef& inst : blk.getInstructions()) {
+            assignSlot(&inst);
+        }
+    }
 }
 
 } // namespace inr
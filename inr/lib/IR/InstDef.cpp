@@ -2,17 +2,79 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/IR/BlockDef.h>
+#include <inr/IR/FuncDef.h>
 #include <inr/IR/InstDef.h>
+#include <inr/IR/TUnit.h>
+#include <inr/Support/Assert.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
 namespace inr {
 
+// The operands are placed in front of the instruction, so the instruction has
+// to stay aligned after them.
+static_assert(sizeof(Use) % alignof(InstDef) == 0);
+static_assert(sizeof(Use*) % alignof(InstDef) == 0);
+
+// Size budget of the instructions, without their operands. Instructions are
+// never destroyed one by one, so they can't own any memory either.
+#define INST_BUDGET(Inst, Budget)                                          \
+    static_assert(sizeof(Inst) <= (Budget), #Inst " grew past its budget");    \
+    static_assert(std::is_trivially_destructible_v<Inst>,                      \
+                  #Inst " must be trivially destructible")
+
+INST_BUDGET(InstDef, 64);
+INST_BUDGET(RetInst, 64);
+INST_BUDGET(JmpInst, 64);
+INST_BUDGET(BinaryInst, 64);
+INST_BUDGET(CmpInst, 64);
+INST_BUDGET(PhiInst, 64);
+INST_BUDGET(UnreachableInst, 64);
+INST_BUDGET(LoadInst, 64);
+INST_BUDGET(StoreInst, 64);
+INST_BUDGET(AllocaInst, 72);
+
+#undef INST_BUDGET
+
+void* InstDef::operator new(std::size_t size, BlockDef* blk,
+                            unsigned numUses, bool hungOffUses) {
+    inr_assert(blk != nullptr, "InstDef operator new(): block is nullptr");
+    std::size_t prefix = hungOffUses ? sizeof(Use*) : numUses * sizeof(Use);
+    // No instruction has members aligned more than the base class.
+    char* mem = (char*)blk->getParent()->getAllocator().allocate(
+        prefix + size, alignof(InstDef));
+    return mem + prefix;
+}
+
+void InstDef::appendTo(BlockDef* blk, InstDef* inst) {
+    blk->getParent()->assignSlot(inst);
+    inst->parent_ = blk;
+    blk->getInstructions().push_back(inst);
+}
+
+PooledString InstDef::internName(BlockDef* blk, std::string_view name) {
+    return blk->getParent()->getParent()->getNames().intern(name);
+}
+
+void PhiInst::growIncoming(BlockDef* blk) {
+    unsigned count = getIncomingCount();
+    unsigned capacity = count ? count * 2 : 4;
+
+    // The old array stays in the allocator until the body is freed.
+    char* mem = (char*)blk->getParent()->getAllocator().allocate(
+        capacity * (sizeof(Use) + sizeof(BlockDef*)), alignof(Use));
+    auto blocks = reinterpret_cast<BlockDef**>(mem + capacity * sizeof(Use));
+    std::copy_n(getBlockArray(), count, blocks);
+    moveUses(reinterpret_cast<Use*>(mem), capacity);
+}
+
 RetInst* RetInst::createRet(TypeMap& tm, BlockDef* blk, Def* retVal) {
     if(retVal) {
-        return (RetInst*)blk->getInstructions().push_back(
-            new RetInst(retVal->getType(), retVal));
+        return append(blk, new(blk, 1) RetInst(retVal->getType(), retVal));
     }
-    return (RetInst*)blk->getInstructions().push_back(
-        new RetInst(tm.getVoid()));
+    return append(blk, new(blk, 0) RetInst(tm.getVoid()));
 }
 
 RetInst* RetInst::createRetVoid(TypeMap& tm, BlockDef* blk) {
@@ -20,128 +82,127 @@ RetInst* RetInst::createRetVoid(TypeMap& tm, BlockDef* blk) {
 }
 
 JmpInst* JmpInst::createJmp(TypeMap& tm, BlockDef* blk, Def* lbl) {
-    return (JmpInst*)blk->getInstructions().push_back(
-        new JmpInst(tm.getVoid(), lbl));
+    return append(blk, new(blk, 1) JmpInst(tm.getVoid(), lbl));
 }
 
 JmpInst* JmpInst::createJmpCond(TypeMap& tm, BlockDef* blk, Def* cond,
                                 Def* iftrue, Def* iffalse) {
-    return (JmpInst*)blk->getInstructions().push_back(
-        new JmpInst(tm.getVoid(), cond, iftrue, iffalse));
+    return append(blk,
+                  new(blk, 3) JmpInst(tm.getVoid(), cond, iftrue, iffalse));
 }
 
 CmpInst* CmpInst::createCmp(TypeMap& tm, BlockDef* blk, CmpCond cond, Def* lhs,
                             Def* rhs, std::string_view name) {
-    return (CmpInst*)blk->getInstructions().push_back(
-        new CmpInst(tm.getI1(), name, cond, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) CmpInst(tm.getI1(), pooled, cond, lhs, rhs));
 }
 
 PhiInst* PhiInst::createPhi(BlockDef* blk, const Type* type,
                             std::string_view name) {
-    return (PhiInst*)blk->getInstructions().push_back(new PhiInst(type, name));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 0, true) PhiInst(type, pooled));
 }
 
 AddInst* AddInst::createAdd(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (AddInst*)blk->getInstructions().push_back(
-        new AddInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) AddInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 MulInst* MulInst::createMul(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (MulInst*)blk->getInstructions().push_back(
-        new MulInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) MulInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 UDivInst* UDivInst::createUDiv(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (UDivInst*)blk->getInstructions().push_back(
-        new UDivInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) UDivInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 SDivInst* SDivInst::createSDiv(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (SDivInst*)blk->getInstructions().push_back(
-        new SDivInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) SDivInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 URemInst* URemInst::createURem(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (URemInst*)blk->getInstructions().push_back(
-        new URemInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) URemInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 SRemInst* SRemInst::createSRem(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (SRemInst*)blk->getInstructions().push_back(
-        new SRemInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) SRemInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 SubInst* SubInst::createSub(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (SubInst*)blk->getInstructions().push_back(
-        new SubInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) SubInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 ShlInst* ShlInst::createShl(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (ShlInst*)blk->getInstructions().push_back(
-        new ShlInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) ShlInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 LShrInst* LShrInst::createLShr(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (LShrInst*)blk->getInstructions().push_back(
-        new LShrInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) LShrInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 AShrInst* AShrInst::createAShr(BlockDef* blk, Def* lhs, Def* rhs,
                                std::string_view name) {
-    return (AShrInst*)blk->getInstructions().push_back(
-        new AShrInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) AShrInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 AndInst* AndInst::createAnd(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (AndInst*)blk->getInstructions().push_back(
-        new AndInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) AndInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 OrInst* OrInst::createOr(BlockDef* blk, Def* lhs, Def* rhs,
                          std::string_view name) {
-    return (OrInst*)blk->getInstructions().push_back(
-        new OrInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) OrInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 XorInst* XorInst::createXor(BlockDef* blk, Def* lhs, Def* rhs,
                             std::string_view name) {
-    return (XorInst*)blk->getInstructions().push_back(
-        new XorInst(lhs->getType(), name, lhs, rhs));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 2) XorInst(lhs->getType(), pooled, lhs, rhs));
 }
 
 UnreachableInst* UnreachableInst::createUnreachable(TypeMap& tm,
                                                     BlockDef* blk) {
-    return (UnreachableInst*)blk->getInstructions().push_back(
-        new UnreachableInst(tm.getVoid()));
+    return append(blk, new(blk, 0) UnreachableInst(tm.getVoid()));
 }
 
 LoadInst* LoadInst::createLoad(BlockDef* blk, const Type* type, Def* from,
                                std::string_view name) {
-    return (LoadInst*)blk->getInstructions().push_back(
-        new LoadInst(type, name, from));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 1) LoadInst(type, pooled, from));
 }
 
 StoreInst* StoreInst::createStore(TypeMap& tm, BlockDef* blk, Def* to,
                                   Def* from) {
-    return (StoreInst*)blk->getInstructions().push_back(
-        new StoreInst(tm.getVoid(), to, from));
+    return append(blk, new(blk, 2) StoreInst(tm.getVoid(), to, from));
 }
 
 AllocaInst* AllocaInst::createAlloca(TypeMap& tm, BlockDef* blk,
                                      const Type* toAllocate, Def* count,
                                      std::string_view name) {
-    return (AllocaInst*)blk->getInstructions().push_back(
-        new AllocaInst(tm.getPtr(), name, toAllocate, count));
+    PooledString pooled = internName(blk, name);
+    return append(blk, new(blk, 1) AllocaInst(tm.getPtr(), pooled, toAllocate,
+                                              count));
 }
 
 } // namespace inr
@@ -0,0 +1,866 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BlockDef.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/Parser.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/Type.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/UnDef.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Math/FPFormat.h>
+#include <inr/Support/Stream.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace inr {
+
+namespace {
+
+enum CharClass : std::uint8_t {
+    /// @brief Whitespace, newlines are not significant.
+    Space = 1,
+    /// @brief Ends a name, names are made of every other character.
+    NameEnd = 2,
+    /// @brief Part of keywords and types.
+    Word = 4,
+    Digit = 8,
+};
+
+constexpr std::array<std::uint8_t, 256> CHAR_CLASSES = [] {
+    std::array<std::uint8_t, 256> classes{};
+    for(char c : {' ', '\t', '\n', '\r'}) classes[c] = Space | NameEnd;
+    for(char c : {',', '(', ')', '[', ']', '{', '}', ':', '='}) {
+        classes[c] = NameEnd;
+    }
+    for(int c = 'a'; c <= 'z'; c++) classes[c] = Word;
+    for(int c = 'A'; c <= 'Z'; c++) classes[c] = Word;
+    for(int c = '0'; c <= '9'; c++) classes[c] = Word | Digit;
+    classes['_'] = classes['.'] = Word;
+    return classes;
+}();
+
+bool is(char c, CharClass cls) {
+    return CHAR_CLASSES[std::uint8_t(c)] & cls;
+}
+
+/// @brief The printer numbers unnamed defs, those names are dropped.
+bool isNumbered(std::string_view name) {
+    return std::all_of(name.begin(), name.end(),
+                       [](char c) { return is(c, Digit); });
+}
+
+/// @brief A value or function by its name, possibly not defined yet.
+struct Symbol {
+    Def* def;
+    /// @brief Where a placeholder was first used, null once defined.
+    const char* pendingUse = nullptr;
+};
+
+/// @brief A block by its name, created by its label or its first use.
+struct BlockSymbol {
+    BlockDef* blk;
+    /// @brief Where the block was first used, null once its label is seen.
+    const char* pendingUse = nullptr;
+};
+
+class Parser {
+    TUnit& unit_;
+    TypeMap& tm_;
+    stream* os_;
+
+    const char* begin_;
+    const char* cur_;
+    const char* end_;
+    bool failed_ = false;
+
+    /// @brief Integer types up to 128 bits, looked up once.
+    const IntType* ints_[129] = {};
+
+    HMap<std::string_view, Symbol> globals_;
+    std::vector<std::string_view> pendingGlobals_;
+
+    /// @brief Function being parsed.
+    FuncDef* fn_ = nullptr;
+    HMap<std::string_view, Symbol> values_;
+    std::vector<std::string_view> pendingValues_;
+    HMap<std::string_view, BlockSymbol> blocks_;
+    std::vector<std::string_view> pendingBlocks_;
+    /// @brief Blocks in the order of their labels.
+    std::vector<BlockDef*> order_;
+
+    std::vector<bigint::Limb> limbs_;
+
+    /// @brief Reports the first error, with the line and column of `at`.
+    template<typename... Args>
+    void fail(const char* at, Args&&... args) {
+        if(failed_) return;
+        failed_ = true;
+        cur_ = end_;
+        if(!os_) return;
+
+        const char* lineStart = at;
+        while(lineStart != begin_ && lineStart[-1] != '\n') lineStart--;
+        const char* lineEnd = std::find(at, end_, '\n');
+        std::size_t line = std::count(begin_, at, '\n') + 1;
+        std::size_t column = std::size_t(at - lineStart) + 1;
+
+        (((*os_) << "ir parser: ").changeColor(col::RED, true) << "error: ")
+            .resetColor();
+        (*os_) << line << ':' << column << ": ";
+        (((*os_) << args), ...);
+        (*os_) << '\n';
+        os_->write(lineStart, std::size_t(lineEnd - lineStart));
+        (*os_) << '\n';
+        os_->indent(unsigned(column - 1));
+        (*os_) << "^\n";
+    }
+
+    void skipSpace() {
+        while(cur_ != end_ && is(*cur_, Space)) cur_++;
+    }
+
+    /// @brief Skips the spaces and returns true if the next char is `c`.
+    bool peek(char c) {
+        skipSpace();
+        return cur_ != end_ && *cur_ == c;
+    }
+
+    bool consume(char c) {
+        if(!peek(c)) return false;
+        cur_++;
+        return true;
+    }
+
+    bool expect(char c) {
+        if(consume(c)) return true;
+        fail(cur_, "expected '", c, '\'');
+        return false;
+    }
+
+    /// @brief Reads a keyword or a type, empty if there is none.
+    std::string_view word() {
+        skipSpace();
+        const char* start = cur_;
+        while(cur_ != end_ && is(*cur_, Word)) cur_++;
+        return {start, std::size_t(cur_ - start)};
+    }
+
+    /// @brief Reads a name after its sigil.
+    std::string_view name() {
+        const char* start = cur_;
+        while(cur_ != end_ && !is(*cur_, NameEnd)) cur_++;
+        if(start == cur_) fail(start, "expected a name");
+        return {start, std::size_t(cur_ - start)};
+    }
+
+    bool consumeVararg() {
+        skipSpace();
+        if(std::size_t(end_ - cur_) < 3 || std::string_view(cur_, 3) != "...") {
+            return false;
+        }
+        cur_ += 3;
+        return true;
+    }
+
+    const IntType* intType(std::uint64_t width) {
+        if(width < std::size(ints_)) {
+            const IntType*& t = ints_[width];
+            if(!t) t = tm_.getInt(unsigned(width));
+            return t;
+        }
+        return tm_.getInt(unsigned(width));
+    }
+
+    /// @brief Returns the type named `w`, which starts at `at`.
+    const Type* typeFromWord(std::string_view w, const char* at) {
+        const Type* t = nullptr;
+        if(w.size() > 1 && w[0] == 'i' && is(w[1], Digit)) {
+            std::uint64_t width = 0;
+            for(char c : w.substr(1)) {
+                if(!is(c, Digit) || width > UINT32_MAX) {
+                    width = 0;
+                    break;
+                }
+                width = width * 10 + unsigned(c - '0');
+            }
+            if(width == 0 || width > UINT32_MAX) {
+                fail(at, "invalid integer width");
+                return nullptr;
+            }
+            t = intType(width);
+        }
+        else if(w == "ptr") t = tm_.getPtr();
+        else if(w == "void") t = tm_.getVoid();
+        else if(w == "block") t = tm_.getBlock();
+        else if(w == "binary16") t = tm_.getFloat(FPFormat::Binary16);
+        else if(w == "binary32") t = tm_.getFloat(FPFormat::Binary32);
+        else if(w == "binary64") t = tm_.getFloat(FPFormat::Binary64);
+        else if(w == "x87_80") t = tm_.getFloat(FPFormat::x87_80);
+        else {
+            fail(at, "expected a type");
+            return nullptr;
+        }
+
+        // A function type has its args right after the return type.
+        if(cur_ == end_ || *cur_ != '(') return t;
+        cur_++;
+        std::vector<const Type*> args;
+        bool vararg = false;
+        if(!consume(')')) {
+            do {
+                if(consumeVararg()) {
+                    vararg = true;
+                    break;
+                }
+                args.push_back(parseType());
+                if(failed_) return nullptr;
+            } while(consume(','));
+            if(!expect(')')) return nullptr;
+        }
+        return tm_.getFunc(t, args, vararg);
+    }
+
+    const Type* parseType() {
+        skipSpace();
+        const char* at = cur_;
+        return typeFromWord(word(), at);
+    }
+
+    /// @brief Reads a `signext` or `zeroext` if there is one.
+    TypeExt parseExt() {
+        skipSpace();
+        const char* at = cur_;
+        std::string_view w = word();
+        if(w == "signext") return TypeExt::SignExt;
+        if(w == "zeroext") return TypeExt::ZeroExt;
+        cur_ = at;
+        return TypeExt::NoExt;
+    }
+
+    /// @brief Parses a constant of type `t`, in signed or unsigned decimal.
+    Def* parseConst(const Type* t, const char* at) {
+        if(!t->isInteger()) {
+            fail(at, "constants must be integers");
+            return nullptr;
+        }
+        bool neg = *cur_ == '-';
+        if(neg) cur_++;
+        const char* digits = cur_;
+        while(cur_ != end_ && is(*cur_, Digit)) cur_++;
+        if(digits == cur_) {
+            fail(at, "expected a value");
+            return nullptr;
+        }
+
+        const IntType* it = (const IntType*)t;
+        unsigned width = it->getWidth();
+        if(width > bigint::LIMB_BITS) {
+            return parseWideConst(it, {digits, std::size_t(cur_ - digits)},
+                                  neg, at);
+        }
+
+        std::uint64_t v = 0;
+        bool fits = true;
+        for(const char* p = digits; p != cur_; p++) {
+            unsigned d = unsigned(*p - '0');
+            if(v > (UINT64_MAX - d) / 10) fits = false;
+            v = v * 10 + d;
+        }
+        // Negative values go down to -2^(width-1).
+        if(!fits || (width < bigint::LIMB_BITS && v >> width) ||
+           (neg && v > std::uint64_t(1) << (width - 1))) {
+            fail(at, "constant doesn't fit in i", width);
+            return nullptr;
+        }
+        return unit_.createConst(it, neg ? 0 - v : v);
+    }
+
+    /// @brief Returns true if the magnitude in `limbs_` is at most
+    /// 2^(width-1), so its negation fits in `width` bits.
+    bool fitsNegated(unsigned width) const {
+        std::size_t top = (width - 1) / bigint::LIMB_BITS;
+        bigint::Limb bit = bigint::Limb(1)
+                           << ((width - 1) % bigint::LIMB_BITS);
+        if(!(limbs_[top] & bit)) return true;
+        if(limbs_[top] & (bit - 1)) return false;
+        for(std::size_t i = 0; i < top; i++) {
+            if(limbs_[i]) return false;
+        }
+        return true;
+    }
+
+    /// @brief Parses the digits of a constant wider than a limb.
+    Def* parseWideConst(const IntType* it, std::string_view digits, bool neg,
+                        const char* at) {
+        unsigned width = it->getWidth();
+        limbs_.assign((width - 1) / bigint::LIMB_BITS + 1, 0);
+
+        // Nine digits at a time, the limbs are multiplied in 32 bit halves.
+        std::uint64_t carry = 0;
+        while(!digits.empty() && !carry) {
+            std::size_t n = std::min<std::size_t>(digits.size(), 9);
+            std::uint64_t mult = 1;
+            carry = 0;
+            for(char c : digits.substr(0, n)) {
+                mult *= 10;
+                carry = carry * 10 + unsigned(c - '0');
+            }
+            digits.remove_prefix(n);
+
+            for(bigint::Limb& limb : limbs_) {
+                std::uint64_t lo = (limb & 0xFFFFFFFF) * mult +
+                                   (carry & 0xFFFFFFFF);
+                std::uint64_t hi =
+                    (limb >> 32) * mult + (lo >> 32) + (carry >> 32);
+                limb = (hi << 32) | (lo & 0xFFFFFFFF);
+                carry = hi >> 32;
+            }
+        }
+        unsigned topBits = width % bigint::LIMB_BITS;
+        if(carry || (topBits && limbs_.back() >> topBits) ||
+           (neg && !fitsNegated(width))) {
+            fail(at, "constant doesn't fit in i", width);
+            return nullptr;
+        }
+
+        bigint val = bigint::fromLimbs(width, limbs_.data());
+        if(neg) val.negate();
+        return unit_.createConst(it, std::move(val));
+    }
+
+    /// @brief Returns the local `n` of type `t`, creating a placeholder if it
+    /// isn't defined yet.
+    Def* localValue(std::string_view n, const Type* t, const char* at) {
+        auto [sym, inserted] = values_.try_emplace(n, Symbol{nullptr, at});
+        if(inserted) {
+            sym->def = fn_->getAllocator().create<UnDef>(t);
+            pendingValues_.push_back(n);
+        }
+        else if(sym->def->getType() != t) {
+            fail(at, "'%", n, "' has a different type");
+            return nullptr;
+        }
+        return sym->def;
+    }
+
+    /// @brief Returns the function `n` of type `t`, creating a placeholder if
+    /// it isn't defined yet.
+    Def* globalValue(std::string_view n, const Type* t, const char* at) {
+        auto [sym, inserted] = globals_.try_emplace(n, Symbol{nullptr, at});
+        if(inserted) {
+            sym->def = unit_.getAllocator().create<UnDef>(t);
+            pendingGlobals_.push_back(n);
+        }
+        else if(sym->def->getType() != t) {
+            fail(at, "'@", n, "' has a different type");
+            return nullptr;
+        }
+        return sym->def;
+    }
+
+    Def* parseValue(const Type* t) {
+        skipSpace();
+        const char* at = cur_;
+        if(cur_ == end_) {
+            fail(at, "expected a value");
+            return nullptr;
+        }
+
+        switch(*cur_) {
+            case '%': {
+                cur_++;
+                std::string_view n = name();
+                return failed_ ? nullptr : localValue(n, t, at);
+            }
+            case '@': {
+                cur_++;
+                std::string_view n = name();
+                return failed_ ? nullptr : globalValue(n, t, at);
+            }
+            case '-':
+                return parseConst(t, at);
+            default:
+                if(is(*cur_, Digit)) return parseConst(t, at);
+                if(word() == "undef") return unit_.createUndef(t);
+                fail(at, "expected a value");
+                return nullptr;
+        }
+    }
+
+    /// @brief Returns the block `%name`, creating it if it is used first.
+    BlockDef* parseBlockRef() {
+        skipSpace();
+        const char* at = cur_;
+        if(!expect('%')) return nullptr;
+        std::string_view n = name();
+        if(failed_) return nullptr;
+
+        auto [sym, inserted] = blocks_.try_emplace(n, BlockSymbol{nullptr, at});
+        if(inserted) {
+            sym->blk = unit_.createBlock(tm_, fn_, isNumbered(n) ? "" : n);
+            pendingBlocks_.push_back(n);
+        }
+        return sym->blk;
+    }
+
+    /// @brief Parses `type value`, or `block %name`.
+    Def* parseTypedOperand() {
+        const Type* t = parseType();
+        if(failed_) return nullptr;
+        if(t == tm_.getBlock()) return parseBlockRef();
+        return parseValue(t);
+    }
+
+    /// @brief Makes `def` the value `n`, replacing its placeholder.
+    void define(std::string_view n, Def* def, const char* at) {
+        auto [sym, inserted] = values_.try_emplace(n, Symbol{def});
+        if(inserted) return;
+        if(!sym->pendingUse) {
+            fail(at, "redefinition of '%", n, '\'');
+            return;
+        }
+        if(sym->def->getType() != def->getType()) {
+            fail(sym->pendingUse, "'%", n, "' has a different type");
+            return;
+        }
+        sym->def->replaceAllUsesWith(def);
+        sym->def = def;
+        sym->pendingUse = nullptr;
+    }
+
+    static InstDef::InstType binaryOp(std::string_view w) {
+        constexpr std::pair<std::string_view, InstDef::InstType> ops[] = {
+            {"add", InstDef::Add},   {"sub", InstDef::Sub},
+            {"mul", InstDef::Mul},   {"udiv", InstDef::UDiv},
+            {"sdiv", InstDef::SDiv}, {"urem", InstDef::URem},
+            {"srem", InstDef::SRem}, {"shl", InstDef::Shl},
+            {"lshr", InstDef::LShr}, {"ashr", InstDef::AShr},
+            {"and", InstDef::And},   {"or", InstDef::Or},
+            {"xor", InstDef::Xor},
+        };
+        for(auto [opName, op] : ops) {
+            if(w == opName) return op;
+        }
+        return InstDef::Ret;
+    }
+
+    static bool cmpCond(std::string_view w, CmpInst::CmpCond& cond) {
+        constexpr std::pair<std::string_view, CmpInst::CmpCond> conds[] = {
+            {"eq", CmpInst::Equal},          {"neq", CmpInst::NotEqual},
+            {"ug", CmpInst::UGreater},       {"uge", CmpInst::UGreaterEqual},
+            {"ul", CmpInst::ULess},          {"ule", CmpInst::ULessEqual},
+            {"sg", CmpInst::SGreater},       {"sge", CmpInst::SGreaterEqual},
+            {"sl", CmpInst::SLess},          {"sle", CmpInst::SLessEqual},
+        };
+        for(auto [condName, c] : conds) {
+            if(w == condName) {
+                cond = c;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    InstDef* createBinary(InstDef::InstType op, BlockDef* blk, Def* lhs,
+                          Def* rhs, std::string_view n) {
+        switch(op) {
+            case InstDef::Add:
+                return AddInst::createAdd(blk, lhs, rhs, n);
+            case InstDef::Sub:
+                return SubInst::createSub(blk, lhs, rhs, n);
+            case InstDef::Mul:
+                return MulInst::createMul(blk, lhs, rhs, n);
+            case InstDef::UDiv:
+                return UDivInst::createUDiv(blk, lhs, rhs, n);
+            case InstDef::SDiv:
+                return SDivInst::createSDiv(blk, lhs, rhs, n);
+            case InstDef::URem:
+                return URemInst::createURem(blk, lhs, rhs, n);
+            case InstDef::SRem:
+                return SRemInst::createSRem(blk, lhs, rhs, n);
+            case InstDef::Shl:
+                return ShlInst::createShl(blk, lhs, rhs, n);
+            case InstDef::LShr:
+                return LShrInst::createLShr(blk, lhs, rhs, n);
+            case InstDef::AShr:
+                return AShrInst::createAShr(blk, lhs, rhs, n);
+            case InstDef::And:
+                return AndInst::createAnd(blk, lhs, rhs, n);
+            case InstDef::Or:
+                return OrInst::createOr(blk, lhs, rhs, n);
+            case InstDef::Xor:
+                return XorInst::createXor(blk, lhs, rhs, n);
+            default:
+                return nullptr;
+        }
+    }
+
+    /// @brief Parses `(lhs, rhs)` with both of type `t`.
+    bool parseOperands(const Type* t, Def*& lhs, Def*& rhs) {
+        if(!expect('(')) return false;
+        lhs = parseValue(t);
+        if(failed_ || !expect(',')) return false;
+        rhs = parseValue(t);
+        return !failed_ && expect(')');
+    }
+
+    /// @brief Parses what comes after `%name =`.
+    bool parseResult(BlockDef* blk, std::string_view n, const char* at) {
+        std::string_view instName = isNumbered(n) ? "" : n;
+        skipSpace();
+        const char* wordAt = cur_;
+        std::string_view w = word();
+
+        if(w == "alloca") {
+            if(!expect('(')) return false;
+            const Type* t = parseType();
+            if(failed_ || !expect(',')) return false;
+            Def* num = parseTypedOperand();
+            if(failed_ || !expect(')')) return false;
+            define(n, AllocaInst::createAlloca(tm_, blk, t, num, instName),
+                   at);
+            return !failed_;
+        }
+
+        const Type* t = typeFromWord(w, wordAt);
+        if(failed_) return false;
+        skipSpace();
+        const char* opAt = cur_;
+        std::string_view op = word();
+
+        if(InstDef::InstType bin = binaryOp(op); bin != InstDef::Ret) {
+            Def *lhs, *rhs;
+            if(!parseOperands(t, lhs, rhs)) return false;
+            define(n, createBinary(bin, blk, lhs, rhs, instName), at);
+        }
+        else if(op.starts_with("cmp.")) {
+            CmpInst::CmpCond cond;
+            if(!cmpCond(op.substr(4), cond)) {
+                fail(opAt, "unknown comparison '", op.substr(4), '\'');
+                return false;
+            }
+            Def *lhs, *rhs;
+            if(!parseOperands(t, lhs, rhs)) return false;
+            define(n, CmpInst::createCmp(tm_, blk, cond, lhs, rhs, instName),
+                   at);
+        }
+        else if(op == "phi") {
+            // Defined first, the incoming values may refer to it.
+            PhiInst* phi = PhiInst::createPhi(blk, t, instName);
+            define(n, phi, at);
+            if(failed_ || !expect('(')) return false;
+            if(consume(')')) return true;
+            do {
+                if(!expect('[')) return false;
+                Def* val = parseValue(t);
+                if(failed_ || !expect(',')) return false;
+                BlockDef* from = parseBlockRef();
+                if(failed_ || !expect(']')) return false;
+                phi->addIncoming(val, from);
+            } while(consume(','));
+            return expect(')');
+        }
+        else if(op == "load") {
+            if(!expect('(')) return false;
+            Def* from = parseValue(tm_.getPtr());
+            if(failed_ || !expect(')')) return false;
+            define(n, LoadInst::createLoad(blk, t, from, instName), at);
+        }
+        else {
+            fail(opAt, "unknown instruction '", op, '\'');
+            return false;
+        }
+        return !failed_;
+    }
+
+    bool parseInst(BlockDef* blk, std::string_view op, const char* at) {
+        if(op == "ret") {
+            const Type* t = parseType();
+            if(failed_) return false;
+            if(t == tm_.getVoid()) {
+                RetInst::createRetVoid(tm_, blk);
+                return true;
+            }
+            Def* val = parseValue(t);
+            if(failed_) return false;
+            RetInst::createRet(tm_, blk, val);
+        }
+        else if(op == "jmp") {
+            Def* ops[3];
+            unsigned n = 0;
+            do {
+                if(n == 3) {
+                    fail(at, "jmp takes a block, or a condition and 2 blocks");
+                    return false;
+                }
+                ops[n++] = parseTypedOperand();
+                if(failed_) return false;
+            } while(consume(','));
+
+            if(n == 1) JmpInst::createJmp(tm_, blk, ops[0]);
+            else if(n == 3) {
+                JmpInst::createJmpCond(tm_, blk, ops[0], ops[1], ops[2]);
+            }
+            else {
+                fail(at, "jmp takes a block, or a condition and 2 blocks");
+                return false;
+            }
+        }
+        else if(op == "store") {
+            Def* to = parseValue(tm_.getPtr());
+            if(failed_ || !expect(',')) return false;
+            Def* from = parseTypedOperand();
+            if(failed_) return false;
+            StoreInst::createStore(tm_, blk, to, from);
+        }
+        else if(op == "unreachable") {
+            UnreachableInst::createUnreachable(tm_, blk);
+        }
+        else {
+            fail(at, "unknown instruction '", op, '\'');
+            return false;
+        }
+        return true;
+    }
+
+    bool parseBody() {
+        blocks_.clear();
+        pendingBlocks_.clear();
+        order_.clear();
+
+        BlockDef* blk = nullptr;
+        while(!consume('}')) {
+            skipSpace();
+            const char* at = cur_;
+            if(cur_ == end_) {
+                fail(at, "expected '}'");
+                return false;
+            }
+
+            if(*cur_ == '%') {
+                cur_++;
+                std::string_view n = name();
+                if(failed_ || !expect('=')) return false;
+                if(!blk) {
+                    fail(at, "instruction outside of a block");
+                    return false;
+                }
+                if(!parseResult(blk, n, at)) return false;
+                continue;
+            }
+
+            std::string_view w = name();
+            if(failed_) return false;
+            if(consume(':')) {
+                auto [sym, inserted] =
+                    blocks_.try_emplace(w, BlockSymbol{nullptr});
+                if(inserted) {
+                    sym->blk =
+                        unit_.createBlock(tm_, fn_, isNumbered(w) ? "" : w);
+                }
+                else if(!sym->pendingUse) {
+                    fail(at, "redefinition of block '", w, '\'');
+                    return false;
+                }
+                sym->pendingUse = nullptr;
+                blk = sym->blk;
+                order_.push_back(blk);
+                continue;
+            }
+
+            if(!blk) {
+                fail(at, "instruction outside of a block");
+                return false;
+            }
+            if(!parseInst(blk, w, at)) return false;
+        }
+
+        return finishBody();
+    }
+
+    /// @brief Checks that everything used was defined, and puts the blocks
+    /// in the order of their labels.
+    bool finishBody() {
+        for(std::string_view n : pendingValues_) {
+            const Symbol* sym = values_.find(n);
+            if(sym->pendingUse) {
+                fail(sym->pendingUse, "use of undefined value '%", n, '\'');
+                return false;
+            }
+        }
+
+        for(std::string_view n : pendingBlocks_) {
+            const BlockSymbol* sym = blocks_.find(n);
+            if(sym->pendingUse) {
+                fail(sym->pendingUse, "use of undefined block '%", n, '\'');
+                return false;
+            }
+        }
+
+        ilist<BlockDef>& blocks = fn_->getBlocks();
+        auto it = blocks.begin();
+        bool inOrder = true;
+        for(BlockDef* blk : order_) {
+            if(&*it++ != blk) {
+                inOrder = false;
+                break;
+            }
+        }
+        if(inOrder) return true;
+
+        // Blocks used before their label were created out of order.
+        blocks.clear();
+        for(BlockDef* blk : order_) blocks.push_back(blk);
+        fn_->renumber();
+        return true;
+    }
+
+    bool parseFunction() {
+        skipSpace();
+        const char* at = cur_;
+        if(word() != "def" || word() != "fn") {
+            fail(at, "expected 'def fn'");
+            return false;
+        }
+
+        TypeExt retExt = parseExt();
+        const Type* ret = parseType();
+        if(failed_) return false;
+
+        Linkage linkage = Linkage::Global;
+        if(!peek('@')) {
+            const char* linkageAt = cur_;
+            std::string_view w = word();
+            if(w == "local") linkage = Linkage::Local;
+            else if(w == "weak") linkage = Linkage::Weak;
+            else {
+                fail(linkageAt, "expected a linkage or '@'");
+                return false;
+            }
+        }
+        if(!expect('@')) return false;
+        const char* nameAt = cur_ - 1;
+        std::string_view fnName = name();
+        if(failed_ || !expect('(')) return false;
+
+        struct Arg {
+            std::string_view name;
+            TypeExt ext;
+            const char* at;
+        };
+        std::vector<const Type*> argTypes;
+        std::vector<Arg> args;
+        bool vararg = false;
+        if(!consume(')')) {
+            do {
+                if(consumeVararg()) {
+                    vararg = true;
+                    break;
+                }
+                argTypes.push_back(parseType());
+                TypeExt ext = parseExt();
+                skipSpace();
+                const char* argAt = cur_;
+                if(failed_ || !expect('%')) return false;
+                args.push_back({name(), ext, argAt});
+                if(failed_) return false;
+            } while(consume(','));
+            if(!expect(')')) return false;
+        }
+
+        const FuncType* ft = tm_.getFunc(ret, argTypes, vararg);
+        fn_ = unit_.createFunction(ft, isNumbered(fnName) ? "" : fnName,
+                                   linkage, retExt);
+        defineGlobal(fnName, nameAt);
+        if(failed_) return false;
+
+        values_.clear();
+        pendingValues_.clear();
+        for(unsigned i = 0; i < args.size(); i++) {
+            ArgDef* arg = fn_->getArg(i);
+            arg->setExt(args[i].ext);
+            if(!isNumbered(args[i].name)) {
+                arg->setName(unit_.getNames().intern(args[i].name));
+            }
+            if(!values_.try_emplace(args[i].name, Symbol{arg}).second) {
+                fail(args[i].at, "redefinition of '%", args[i].name, '\'');
+                return false;
+            }
+        }
+
+        if(!consume('{')) return true;
+        return parseBody();
+    }
+
+    void defineGlobal(std::string_view n, const char* at) {
+        auto [sym, inserted] = globals_.try_emplace(n, Symbol{fn_});
+        if(inserted) return;
+        if(!sym->pendingUse) {
+            fail(at, "redefinition of '@", n, '\'');
+            return;
+        }
+        if(sym->def->getType() != fn_->getType()) {
+            fail(sym->pendingUse, "'@", n, "' has a different type");
+            return;
+        }
+        sym->def->replaceAllUsesWith(fn_);
+        sym->def = fn_;
+        sym->pendingUse = nullptr;
+    }
+
+    void skipModuleName() {
+        skipSpace();
+        constexpr std::string_view key = "module.name";
+        if(std::string_view(cur_, std::size_t(end_ - cur_)).starts_with(key)) {
+            cur_ = std::find(cur_, end_, '\n');
+        }
+    }
+
+public:
+    Parser(TUnit& unit, TypeMap& tm, std::string_view src, stream* os) :
+        unit_(unit),
+        tm_(tm),
+        os_(os),
+        begin_(src.data()),
+        cur_(src.data()),
+        end_(src.data() + src.size()) {}
+
+    bool parse() {
+        skipModuleName();
+        skipSpace();
+        while(cur_ != end_) {
+            if(!parseFunction()) return false;
+            skipSpace();
+        }
+
+        for(std::string_view n : pendingGlobals_) {
+            const Symbol* sym = globals_.find(n);
+            if(sym->pendingUse) {
+                fail(sym->pendingUse, "use of undefined function '@", n,
+                     '\'');
+                return false;
+            }
+        }
+        return !failed_;
+    }
+};
+
+} // namespace
+
+bool IRParser::parse(TUnit& unit, TypeMap& tm, std::string_view src,
+                     stream* os) {
+    return Parser(unit, tm, src, os).parse();
+}
+
+} // namespace inr
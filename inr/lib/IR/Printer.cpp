@@ -5,6 +5,7 @@
 #include <inr/IR/BlockDef.h>
 #include <inr/IR/ConstDef.h>
 #include <inr/IR/Def.h>
+#include <inr/IR/DenseDefMap.h>
 #include <inr/IR/FuncDef.h>
 #include <inr/IR/InstDef.h>
 #include <inr/IR/Printer.h>
@@ -48,7 +49,8 @@ stream& IRPrinter::printDef(stream& os, const Def* def, bool prefix) {
         os << sv;
     }
     else {
-        auto [v, e] = defNames_.try_emplace(def, counter_);
+        auto& names = def->isUnitLevel() ? globalNames_ : defNames_;
+        auto [v, e] = names.try_emplace(def, counter_);
         if(e) counter_++;
         os << *v;
     }
@@ -78,6 +80,7 @@ static inline void printType(stream& os, const Type* type) {
                 if(i) os << ", ";
                 printType(os, ft->getArg(i));
             }
+            if(ft->isVararg()) os << (ft->getNumArgs() ? ", ..." : "...");
             os << ')';
         } break;
         case Type::Float:
@@ -321,6 +324,7 @@ void IRPrinter::printBlock(stream& os, const BlockDef& blk) {
 }
 
 void IRPrinter::printFunction(stream& os, const FuncDef& fd) {
+    defNames_.reset(fd);
     printSignature(os, fd);
     if(!fd.getBlocks().empty()) {
         os << " {\n";
@@ -374,13 +378,14 @@ void IRPrinter::printSignature(stream& os, const FuncDef& fd) {
         os << ' ';
         printDef(os, ad);
     }
+    if(ft->isVararg()) os << (fd.getNumArgs() ? ", ..." : "...");
 
     os << ')';
 }
 
 void IRPrinter::print(stream& os) {
     counter_ = 0;
-    defNames_.clear();
+    globalNames_.reset(unit_);
     if(!unit_.getName().empty()) {
         os << "module.name = " << unit_.getName() << "\n\n";
     }
@@ -8,11 +8,80 @@
 #include <inr/IR/UnDef.h>
 #include <inr/Support/Assert.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 namespace inr {
 
+// Everything but the constants is released by the allocator without running
+// any destructors.
+static_assert(std::is_trivially_destructible_v<FuncDef>);
+static_assert(std::is_trivially_destructible_v<BlockDef>);
+static_assert(std::is_trivially_destructible_v<ArgDef>);
+static_assert(std::is_trivially_destructible_v<UnDef>);
+
+namespace {
+
+/// @brief Key used to look up a constant without creating it.
+struct ConstLookup {
+    const IntType* type;
+    const bigint::Limb* limbs;
+    unsigned count;
+};
+
+std::size_t hashConst(const Type* type, const bigint::Limb* limbs,
+                      unsigned count) {
+    std::size_t seed =
+        HMapInfo<bigint::Limb>::hash(limbs[0] ^ bigint::Limb(type));
+    for(unsigned i = 1; i < count; i++) {
+        seed ^= HMapInfo<bigint::Limb>::hash(limbs[i]) + 0x9e3779b9 +
+                (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+} // namespace
+
+struct TUnit::ConstInfo {
+    static std::size_t hash(const ConstDef* c) {
+        const bigint& val = c->getInteger();
+        return hashConst(c->getType(), val.getLimbs(), val.getLimbCount());
+    }
+
+    static std::size_t hash(const ConstLookup& l) {
+        return hashConst(l.type, l.limbs, l.count);
+    }
+
+    static bool equal(const ConstLookup& lhs, const ConstDef* rhs) {
+        // Same type means the same amount of limbs.
+        if(lhs.type != rhs->getType()) return false;
+        const bigint::Limb* limbs = rhs->getInteger().getLimbs();
+        if(lhs.count == 1) [[likely]] {
+            return lhs.limbs[0] == limbs[0];
+        }
+        return std::equal(lhs.limbs, lhs.limbs + lhs.count, limbs);
+    }
+
+    static bool equal(const ConstDef* lhs, const ConstDef* rhs) {
+        return lhs == rhs;
+    }
+};
+
+TUnit::~TUnit() {
+    for(ConstDef* c : wideConsts_) {
+        c->~ConstDef();
+    }
+}
+
 FuncDef* TUnit::createFunction(const FuncType* type, std::string_view name,
                                Linkage linkage, TypeExt retExt) {
-    return funcs_.push_back(new FuncDef(type, name, linkage, retExt));
+    auto fn = new(allocator_.allocate<FuncDef>())
+        FuncDef(this, type, names_.intern(name), linkage, retExt);
+    assignSlot(fn);
+    return funcs_.push_back(fn);
 }
 
 BlockDef* TUnit::createBlock(TypeMap& tm, FuncDef* to, std::string_view name) {
@@ -20,23 +89,60 @@ BlockDef* TUnit::createBlock(TypeMap& tm, FuncDef* to, std::string_view name) {
     return to->createBlock(tm.getBlock(), name);
 }
 
+ConstDef* TUnit::findConst(const IntType* type, const bigint::Limb* limbs,
+                           unsigned count) const {
+    ConstDef* const* c = consts_.find(ConstLookup{type, limbs, count});
+    return c ? *c : nullptr;
+}
+
+ConstDef* TUnit::insertConst(ConstDef* c) {
+    assignSlot(c);
+    consts_.try_emplace(c);
+    if(c->getInteger().getLimbCount() > 1) wideConsts_.push_back(c);
+    return c;
+}
+
 ConstDef* TUnit::createConst(const IntType* type, const bigint& val) {
     inr_assert(type->getWidth() == val.getBits(),
                "TUnit createConst(): bit width does not match");
-    return (ConstDef*)defStorage_.emplace_back(new ConstDef(type, val)).get();
+    if(ConstDef* c = findConst(type, val.getLimbs(), val.getLimbCount())) {
+        return c;
+    }
+    return insertConst(new(allocator_.allocate<ConstDef>())
+                           ConstDef(type, val));
 }
 
 ConstDef* TUnit::createConst(const IntType* type, bigint&& val) {
     inr_assert(type->getWidth() == val.getBits(),
                "TUnit createConst(): bit width does not match");
-    return (ConstDef*)defStorage_
-        .emplace_back(new ConstDef(type, std::move(val)))
-        .get();
+    if(ConstDef* c = findConst(type, val.getLimbs(), val.getLimbCount())) {
+        return c;
+    }
+    return insertConst(new(allocator_.allocate<ConstDef>())
+                           ConstDef(type, std::move(val)));
+}
+
+ConstDef* TUnit::createConst(const IntType* type, bigint::Limb val) {
+    unsigned width = type->getWidth();
+    if(width > bigint::LIMB_BITS) {
+        return createConst(type, bigint(width, val));
+    }
+
+    // Single limb fast path, the bigint is only created for new constants.
+    if(width < bigint::LIMB_BITS) val &= (bigint::Limb(1) << width) - 1;
+    if(ConstDef* c = findConst(type, &val, 1)) return c;
+    return insertConst(new(allocator_.allocate<ConstDef>())
+                           ConstDef(type, bigint(width, val)));
 }
 
 UnDef* TUnit::createUndef(const Type* t) {
     inr_assert(t != nullptr, "TUnit createUndef(): Type is nullptr");
-    return (UnDef*)defStorage_.emplace_back(new UnDef(t)).get();
+    auto [u, inserted] = undefs_.try_emplace(t, nullptr);
+    if(inserted) {
+        *u = allocator_.create<UnDef>(t);
+        assignSlot(*u);
+    }
+    return *u;
 }
 
 } // namespace inr
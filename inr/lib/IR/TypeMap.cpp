@@ -2,49 +2,50 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/ADT/ArrView.h>
-#include <inr/ADT/HMap.h>
-#include <inr/ADT/HSet.h>
+#include <inr/ADT/ConcurrentHMap.h>
+#include <inr/ADT/HMapInfo.h>
 #include <inr/IR/Type.h>
 #include <inr/IR/TypeMap.h>
 #include <inr/Math/FPFormat.h>
 #include <inr/Support/Assert.h>
 
+#include <cstddef>
 #include <memory>
-#include <new>
 
 namespace inr {
 
+/// @brief A signature to look up, with its hash computed once.
 struct FuncLookup {
     const Type* ret;
     arrview<const Type*> args;
     bool vararg;
+    std::size_t hash;
 };
 
-template<>
-struct HMapInfo<std::unique_ptr<FuncType>> {
-    static std::size_t hash(const std::unique_ptr<FuncType>& ft) {
-        std::size_t seed = HMapInfo<const Type*>::hash(ft->getReturn());
-        seed ^= std::size_t(ft->isVararg()) + 0x9e3779b9 + (seed << 6) +
-                (seed >> 2);
-        for(unsigned i = 0; i < ft->getNumArgs(); i++) {
-            seed ^= HMapInfo<const Type*>::hash(ft->getArg(i)) + 0x9e3779b9 +
+struct FuncTypeInfo {
+    static std::size_t hashSignature(const Type* ret, arrview<const Type*> args,
+                                     bool vararg) {
+        std::size_t seed = HMapInfo<const Type*>::hash(ret);
+        seed ^= std::size_t(vararg) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        for(unsigned i = 0; i < args.size(); i++) {
+            seed ^= HMapInfo<const Type*>::hash(args[i]) + 0x9e3779b9 +
                     (seed << 6) + (seed >> 2);
         }
         return seed;
     }
 
+    static std::size_t hash(const std::unique_ptr<FuncType>& ft) {
+        return ft->getHash();
+    }
+
     static std::size_t hash(const FuncLookup& ft) {
-        std::size_t seed = HMapInfo<const Type*>::hash(ft.ret);
-        seed ^= std::size_t(ft.vararg) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-        for(unsigned i = 0; i < ft.args.size(); i++) {
-            seed ^= HMapInfo<const Type*>::hash(ft.args[i]) + 0x9e3779b9 +
-                    (seed << 6) + (seed >> 2);
-        }
-        return seed;
+        return ft.hash;
     }
 
     static bool equal(const FuncLookup& lhs,
                       const std::unique_ptr<FuncType>& rhs) {
+        if(lhs.hash != rhs->getHash()) return false;
+        if(lhs.ret != rhs->getReturn()) return false;
         if(lhs.args.size() != rhs->getNumArgs()) return false;
         if(lhs.vararg != rhs->isVararg()) return false;
 
@@ -57,6 +58,8 @@ struct HMapInfo<std::unique_ptr<FuncType>> {
 
     static bool equal(const std::unique_ptr<FuncType>& lhs,
                       const std::unique_ptr<FuncType>& rhs) {
+        if(lhs->getHash() != rhs->getHash()) return false;
+        if(lhs->getReturn() != rhs->getReturn()) return false;
         if(lhs->getNumArgs() != rhs->getNumArgs()) return false;
         if(lhs->isVararg() != rhs->isVararg()) return false;
 
@@ -68,9 +71,17 @@ struct HMapInfo<std::unique_ptr<FuncType>> {
     }
 };
 
+/// @brief Types are only ever added, so both maps are insert only concurrent
+/// maps: finding an existing type takes no lock, creating one locks a single
+/// shard. The types are owned by the maps and never move.
 class TypeMapInternal {
-    HMap<unsigned, std::unique_ptr<IntType>> integerMap_;
-    HSet<std::unique_ptr<FuncType>> funcsSet_;
+    /// @brief Odd integer widths are rare, a few shards are enough.
+    ConcurrentHMap<unsigned, std::unique_ptr<IntType>, HMapInfo<unsigned>, 4>
+        integerMap_;
+    /// @brief Maps every function type to itself, so lookups return it.
+    ConcurrentHMap<std::unique_ptr<FuncType>, const FuncType*, FuncTypeInfo,
+                   16>
+        funcsMap_;
 
 public:
     const VoidType* getVoidType() const {
@@ -121,27 +132,29 @@ public:
                 break;
         }
 
-        auto [val, emp] = integerMap_.try_emplace(width, nullptr);
-        if(emp) {
-            val->reset(new IntType(width));
+        if(auto v = integerMap_.find(width)) {
+            return v->get();
         }
-        return val->get();
+
+        // If another thread created it first, ours is freed and theirs kept.
+        return integerMap_
+            .try_emplace(width, std::unique_ptr<IntType>(new IntType(width)))
+            .first->get();
     }
 
     const FuncType* getFuncType(const Type* ret, arrview<const Type*> args,
                                 bool vararg) {
-        FuncLookup lookup(ret, args, vararg);
+        FuncLookup lookup(ret, args, vararg,
+                          FuncTypeInfo::hashSignature(ret, args, vararg));
 
-        if(auto v = funcsSet_.find(lookup)) {
-            return v->get();
+        if(auto v = funcsMap_.find(lookup)) {
+            return *v;
         }
 
-        auto [v, e] = funcsSet_.try_emplace(
-            std::unique_ptr<FuncType>(new FuncType(ret, args, vararg)));
-
-        inr_assert(e,
-                   "TypeMapInternal getFuncType(): the type must be emplaced");
-        return v->get();
+        std::unique_ptr<FuncType> ft(
+            new FuncType(ret, args, vararg, lookup.hash));
+        const FuncType* created = ft.get();
+        return *funcsMap_.try_emplace(std::move(ft), created).first;
     }
 };
 
@@ -99,6 +99,13 @@ bigint::bigint(unsigned bits, Limb val, bool signExt) : bigint(bits) {
     bitOr(val, signExt);
 }
 
+bigint bigint::fromLimbs(unsigned bits, const Limb* limbs) {
+    bigint res(bits);
+    std::memcpy(res.getData(), limbs, sizeof(Limb) * res.getLimbCount());
+    res.clearTopBits();
+    return res;
+}
+
 bigint::bigint(const bigint& other) {
     unsigned limbs = allocateNewStorage(other.bits_);
     if(limbs) {
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Allocator.h>
+#include <inr/Support/Assert.h>
+
+#include <cstddef>
+#include <new>
+
+namespace inr {
+
+BumpAllocator::BumpAllocator(size_type slabSize) : slabSize_(slabSize) {
+    inr_assert(slabSize_ > sizeof(Slab),
+               "BumpAllocator BumpAllocator(): slab size is too small");
+}
+
+BumpAllocator::BumpAllocator(BumpAllocator&& other) noexcept :
+    slabs_(other.slabs_),
+    cur_(other.cur_),
+    end_(other.end_),
+    slabSize_(other.slabSize_),
+    bytesAllocated_(other.bytesAllocated_),
+    bytesReserved_(other.bytesReserved_),
+    slabCount_(other.slabCount_) {
+    other.slabs_ = nullptr;
+    other.cur_ = other.end_ = 0;
+    other.bytesAllocated_ = other.bytesReserved_ = other.slabCount_ = 0;
+}
+
+BumpAllocator& BumpAllocator::operator=(BumpAllocator&& other) noexcept {
+    if(this != &other) {
+        reset();
+        slabs_ = other.slabs_;
+        cur_ = other.cur_;
+        end_ = other.end_;
+        slabSize_ = other.slabSize_;
+        bytesAllocated_ = other.bytesAllocated_;
+        bytesReserved_ = other.bytesReserved_;
+        slabCount_ = other.slabCount_;
+
+        other.slabs_ = nullptr;
+        other.cur_ = other.end_ = 0;
+        other.bytesAllocated_ = other.bytesReserved_ = other.slabCount_ = 0;
+    }
+    return *this;
+}
+
+BumpAllocator::Slab* BumpAllocator::newSlab(size_type size) {
+    Slab* slab = (Slab*)::operator new(size);
+    slab->size_ = size;
+    bytesReserved_ += size;
+    slabCount_++;
+    return slab;
+}
+
+void* BumpAllocator::allocateSlow(size_type size, size_type align) {
+    size_type padded = size + align - 1;
+
+    // Big allocations get their own slab, it is linked behind the current one
+    // so the space left in the current slab is not wasted.
+    if(padded > (slabSize_ - sizeof(Slab)) / 2) {
+        Slab* slab = newSlab(sizeof(Slab) + padded);
+        if(slabs_) {
+            slab->prev_ = slabs_->prev_;
+            slabs_->prev_ = slab;
+        }
+        else {
+            slab->prev_ = nullptr;
+            slabs_ = slab;
+        }
+
+        std::uintptr_t start = std::uintptr_t(slab + 1);
+        std::uintptr_t ptr = (start + (align - 1)) & ~std::uintptr_t(align - 1);
+        bytesAllocated_ += size;
+        return (void*)ptr;
+    }
+
+    Slab* slab = newSlab(slabSize_);
+    slab->prev_ = slabs_;
+    slabs_ = slab;
+
+    cur_ = std::uintptr_t(slab + 1);
+    end_ = std::uintptr_t(slab) + slabSize_;
+
+    std::uintptr_t ptr = (cur_ + (align - 1)) & ~std::uintptr_t(align - 1);
+    inr_assert(ptr + size <= end_,
+               "BumpAllocator allocateSlow(): allocation doesn't fit the slab");
+
+    cur_ = ptr + size;
+    bytesAllocated_ += size;
+    return (void*)ptr;
+}
+
+void BumpAllocator::reset() {
+    Slab* slab = slabs_;
+    while(slab) {
+        Slab* prev = slab->prev_;
+        ::operator delete(slab);
+        slab = prev;
+    }
+
+    slabs_ = nullptr;
+    cur_ = end_ = 0;
+    bytesAllocated_ = bytesReserved_ = slabCount_ = 0;
+}
+
+} // namespace inr
@@ -23,33 +23,29 @@ stream::stream(size_type bufferSize) :
 }
 
 stream& stream::write(cbuff_t data, size_type size) {
-    if(!start_) writeImpl(data, size);
-    else {
-        size_type bufsiz = getBufferSize();
-
-        while(size) {
-            size_type spaceLeft = getCharsInBuffer();
-
-            if(spaceLeft >= bufsiz) {
-                flush();
-                writeImpl(data, size);
-                break;
-            }
-
-            if(!spaceLeft) {
-                flush();
-                spaceLeft = bufsiz;
-            }
-
-            size_type toCopy = std::min(size, spaceLeft);
+    if(!start_) {
+        writeImpl(data, size);
+        return *this;
+    }
 
-            std::memcpy(cur_, data, toCopy);
+    if(size <= getSpaceLeft()) {
+        std::memcpy(cur_, data, size);
+        cur_ += size;
+        return *this;
+    }
 
-            cur_ += toCopy;
-            data += toCopy;
-            size -= toCopy;
-        }
+    // Too big to be worth copying, goes out together with the buffer.
+    if(size >= getBufferSize()) {
+        writeGatherImpl(start_, getCharsInBuffer(), data, size);
+        cur_ = start_;
+        return *this;
     }
+
+    size_type toCopy = getSpaceLeft();
+    std::memcpy(cur_, data, toCopy);
+    writeImpl(start_, getBufferSize());
+    std::memcpy(start_, data + toCopy, size - toCopy);
+    cur_ = start_ + (size - toCopy);
     return *this;
 }
 
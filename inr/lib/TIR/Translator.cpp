@@ -19,6 +19,15 @@
 namespace inr {
 
 TOperand Translator::getVreg(const Def* def) {
+    if(def->isUnitLevel()) {
+        auto [e, v] = constMap_.try_emplace(
+            def, ConstOperand{TOperand::createVReg(vregN_), nullptr});
+        if(v) {
+            vregN_++;
+        }
+        return e->op;
+    }
+
     auto [e, v] = operandMap_.try_emplace(def, TOperand::createVReg(vregN_));
     if(v) {
         vregN_++;
@@ -27,6 +36,10 @@ TOperand Translator::getVreg(const Def* def) {
 }
 
 const TOperand* Translator::findOperand(const Def* def) const {
+    if(def->isUnitLevel()) {
+        const ConstOperand* c = constMap_.find(def);
+        return c ? &c->op : nullptr;
+    }
     return operandMap_.find(def);
 }
 
@@ -183,22 +196,28 @@ bool Translator::translateAlloca(TBlock* tblk, const AllocaInst& alloca) {
 }
 
 bool Translator::translateConst(TBlock* tblk, const ConstDef& cDef) {
-    auto [e, v] = operandMap_.try_emplace(&cDef, TOperand::createVReg(vregN_));
-    if(v) {
+    auto [e, v] = constMap_.try_emplace(
+        &cDef, ConstOperand{TOperand::createVReg(vregN_), nullptr});
+    if(e->block != tblk) {
+        if(!v) e->op = TOperand::createVReg(vregN_);
+        e->block = tblk;
         vregN_++;
         auto inst = tblk->addInst(TInst::gInteger, getType(cDef.getType()));
-        inst->addOperand(*e);
+        inst->addOperand(e->op);
         inst->addOperand(TOperand::createBImm(&cDef.getInteger()));
     }
     return true;
 }
 
 bool Translator::translateUndef(TBlock* tblk, const UnDef& uDef) {
-    auto [e, v] = operandMap_.try_emplace(&uDef, TOperand::createVReg(vregN_));
-    if(v) {
+    auto [e, v] = constMap_.try_emplace(
+        &uDef, ConstOperand{TOperand::createVReg(vregN_), nullptr});
+    if(e->block != tblk) {
+        if(!v) e->op = TOperand::createVReg(vregN_);
+        e->block = tblk;
         vregN_++;
         auto inst = tblk->addInst(TInst::gUndef, getType(uDef.getType()));
-        inst->addOperand(*e);
+        inst->addOperand(e->op);
     }
     return true;
 }
@@ -295,8 +314,10 @@ bool Translator::translateArgs(TSymbol* sym, TBlock* to) {
 
 TModule Translator::translate(const TUnit& unit) {
     TModule mod(&unit);
+    constMap_.reset(unit);
 
     for(const FuncDef& func : unit.getFuncs()) {
+        operandMap_.reset(func);
         auto sym = translateFunc(mod, func);
 
         for(const BlockDef& blk : func.getBlocks()) {
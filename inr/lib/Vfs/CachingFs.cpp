@@ -0,0 +1,281 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Vfs/CachingFs.h>
+#include <inr/Vfs/Path.h>
+
+namespace inr::vfs {
+
+namespace {
+
+/// @brief Forgets its path every time it's written to.
+class CachingFile : public File {
+    std::unique_ptr<File> file_;
+    CachingFilesystem& fs_;
+    std::string key_;
+
+public:
+    CachingFile(std::unique_ptr<File> file, CachingFilesystem& fs,
+                std::string key) :
+        file_(std::move(file)), fs_(fs), key_(std::move(key)) {}
+
+    std::size_t read(void* buffer, std::size_t bytes) override {
+        return file_->read(buffer, bytes);
+    }
+
+    std::size_t write(const void* buffer, std::size_t bytes) override {
+        std::size_t res = file_->write(buffer, bytes);
+        fs_.invalidate(key_);
+        return res;
+    }
+
+    bool seek(std::size_t offset, SeekType st) override {
+        return file_->seek(offset, st);
+    }
+
+    std::size_t tell() const override {
+        return file_->tell();
+    }
+
+    std::size_t readv(arrview<IOVec> vecs) override {
+        return file_->readv(vecs);
+    }
+
+    std::size_t writev(arrview<ConstIOVec> vecs) override {
+        std::size_t res = file_->writev(vecs);
+        fs_.invalidate(key_);
+        return res;
+    }
+
+    std::size_t pread(void* buffer, std::size_t bytes,
+                      std::size_t offset) override {
+        return file_->pread(buffer, bytes, offset);
+    }
+
+    std::size_t pwrite(const void* buffer, std::size_t bytes,
+                       std::size_t offset) override {
+        std::size_t res = file_->pwrite(buffer, bytes, offset);
+        fs_.invalidate(key_);
+        return res;
+    }
+
+    std::error_code sync() override {
+        return file_->sync();
+    }
+};
+
+/// @brief Returns true if `normalize` would return `path` as is.
+bool isNormal(std::string_view path) {
+    if(path.size() > 1 && path.back() == '/') return false;
+
+    std::size_t start = 0;
+    while(start < path.size()) {
+        std::size_t end = path.find('/', start);
+        if(end == std::string_view::npos) end = path.size();
+
+        std::string_view comp = path.substr(start, end - start);
+        if((comp.empty() && start) || comp == "." || comp == "..") {
+            return path == ".";
+        }
+        start = end + 1;
+    }
+    return !path.empty();
+}
+
+/// @brief Normalizing allocates, most paths are normal already.
+std::string key(std::string_view path) {
+    if(isNormal(path)) return std::string(path);
+    return normalize(path);
+}
+
+bool missing(const FSStat& st) {
+    return st.getFT() == FileType::NotFound || st.getFT() == FileType::None;
+}
+
+} // namespace
+
+bool CachingFilesystem::knownMissing(const std::string& key) {
+    std::lock_guard lock(mutex_);
+    const FSStat* st = cache_.find(key);
+    if(!st || !missing(*st)) return false;
+    hits_++;
+    return true;
+}
+
+FSStat CachingFilesystem::fetch(std::string_view path, std::string key,
+                                std::uint64_t generation,
+                                std::error_code& ec) {
+    FSStat st = fs_.stat(path, ec);
+
+    std::lock_guard lock(mutex_);
+    misses_++;
+    // Errors may not last, only answers are kept. An invalidation while the
+    // stat ran may have been for this path, the answer could be stale.
+    if(!ec && generation == generation_) {
+        cache_.try_emplace(std::move(key), st);
+    }
+    return st;
+}
+
+void CachingFilesystem::forget(const std::string& key) {
+    generation_++;
+    cache_.erase(key);
+    std::string_view dir = parent(key);
+    cache_.erase(dir.empty() ? std::string(".") : std::string(dir));
+}
+
+void CachingFilesystem::invalidate(std::string_view path) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+    forget(k);
+}
+
+void CachingFilesystem::clear() {
+    std::lock_guard lock(mutex_);
+    generation_++;
+    cache_.clear();
+}
+
+std::size_t CachingFilesystem::getHits() const {
+    std::lock_guard lock(mutex_);
+    return hits_;
+}
+
+std::size_t CachingFilesystem::getMisses() const {
+    std::lock_guard lock(mutex_);
+    return misses_;
+}
+
+void CachingFilesystem::dumpStats(stream& os) const {
+    std::lock_guard lock(mutex_);
+    std::size_t total = hits_ + misses_;
+    std::size_t rate = total ? hits_ * 100 / total : 0;
+    os << "stat cache: " << hits_ << " hits, " << misses_ << " misses ("
+       << rate << "% hit rate), " << cache_.size() << " entries\n";
+}
+
+std::unique_ptr<File> CachingFilesystem::open(std::string_view path,
+                                              OpenMode om,
+                                              std::error_code& ec) {
+    std::string k = key(path);
+    if(!(om & OWRITE)) {
+        if(knownMissing(k)) {
+            ec = std::make_error_code(std::errc::no_such_file_or_directory);
+            return nullptr;
+        }
+        return fs_.open(path, om, ec);
+    }
+
+    // Opening for writing may create or truncate it.
+    auto file = fs_.open(path, om, ec);
+    invalidate(k);
+    if(!file) return nullptr;
+    return std::make_unique<CachingFile>(std::move(file), *this,
+                                         std::move(k));
+}
+
+std::error_code CachingFilesystem::rm(std::string_view path) {
+    std::error_code ec = fs_.rm(path);
+    invalidate(path);
+    return ec;
+}
+
+std::error_code CachingFilesystem::mkdir(std::string_view path) {
+    std::error_code ec = fs_.mkdir(path);
+
+    // Missing parents may have been made too.
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+    generation_++;
+    std::string_view dir = k;
+    while(!dir.empty()) {
+        cache_.erase(std::string(dir));
+        std::string_view up = parent(dir);
+        if(up == dir) break;
+        dir = up;
+    }
+    cache_.erase(".");
+    return ec;
+}
+
+std::error_code CachingFilesystem::rename(std::string_view from,
+                                          std::string_view to) {
+    std::error_code ec = fs_.rename(from, to);
+    if(ec) {
+        invalidate(from);
+        invalidate(to);
+        return ec;
+    }
+
+    // Everything under a moved directory moved with it, and the cache can't
+    // find the entries below a path, so it's all forgotten.
+    std::error_code statEc;
+    if(fs_.stat(to, statEc).getFT() == FileType::Directory || statEc) {
+        clear();
+        return ec;
+    }
+    invalidate(from);
+    invalidate(to);
+    return ec;
+}
+
+std::unique_ptr<OutputFile>
+CachingFilesystem::createOutput(std::string_view path, std::size_t sizeHint,
+                                std::error_code& ec) {
+    // The wrapped fs makes it, committing it renames through the cache.
+    auto out = fs_.createOutput(path, sizeHint, ec);
+    if(out) out->setFilesystem(*this);
+    return out;
+}
+
+std::vector<std::string> CachingFilesystem::listDirs(std::string_view path,
+                                                     std::error_code& ec) {
+    return fs_.listDirs(path, ec);
+}
+
+FSStat CachingFilesystem::stat(std::string_view path, std::error_code& ec) {
+    std::string k = key(path);
+    std::uint64_t generation;
+    {
+        std::lock_guard lock(mutex_);
+        if(const FSStat* st = cache_.find(k)) {
+            hits_++;
+            return *st;
+        }
+        generation = generation_;
+    }
+    return fetch(path, std::move(k), generation, ec);
+}
+
+std::unique_ptr<MappedFile> CachingFilesystem::map(std::string_view path,
+                                                   Advice advice,
+                                                   std::error_code& ec) {
+    if(knownMissing(key(path))) {
+        ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        return nullptr;
+    }
+    return fs_.map(path, advice, ec);
+}
+
+std::error_code CachingFilesystem::walk(std::string_view path,
+                                        DirVisitor& visitor) {
+    return fs_.walk(path, visitor);
+}
+
+bool CachingFilesystem::exists(std::string_view path) {
+    std::string k = key(path);
+    std::uint64_t generation;
+    {
+        std::lock_guard lock(mutex_);
+        if(const FSStat* st = cache_.find(k)) {
+            hits_++;
+            return !missing(*st);
+        }
+        generation = generation_;
+    }
+    std::error_code ec;
+    FSStat st = fetch(path, std::move(k), generation, ec);
+    return !ec && !missing(st);
+}
+
+} // namespace inr::vfs
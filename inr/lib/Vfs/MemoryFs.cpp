@@ -0,0 +1,319 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/Path.h>
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+
+namespace inr::vfs {
+
+struct MemoryFilesystem::Node {
+    FileType ft;
+    std::uint64_t inode;
+    std::uint64_t mtime;
+    /// @brief Contents of a file.
+    std::string data;
+    /// @brief Names of the entries of a directory.
+    std::vector<std::string> children;
+
+    Node(FileType ft, std::uint64_t inode) :
+        ft(ft), inode(inode), mtime(std::uint64_t(std::time(nullptr))) {}
+};
+
+namespace {
+
+using Node = MemoryFilesystem::Node;
+
+class MemoryFile : public File {
+    std::shared_ptr<Node> node_;
+    std::size_t pos_ = 0;
+    OpenMode om_;
+
+public:
+    MemoryFile(std::shared_ptr<Node> node, OpenMode om) :
+        node_(std::move(node)), om_(om) {}
+
+    std::size_t read(void* buffer, std::size_t bytes) override {
+        if(!(om_ & OREAD) || pos_ >= node_->data.size()) return 0;
+        bytes = std::min(bytes, node_->data.size() - pos_);
+        std::memcpy(buffer, node_->data.data() + pos_, bytes);
+        pos_ += bytes;
+        return bytes;
+    }
+
+    std::size_t write(const void* buffer, std::size_t bytes) override {
+        if(!(om_ & OWRITE)) return 0;
+        std::string& data = node_->data;
+        if(om_ & OAPPEND) pos_ = data.size();
+
+        if(pos_ + bytes > data.size()) data.resize(pos_ + bytes);
+        std::memcpy(data.data() + pos_, buffer, bytes);
+        pos_ += bytes;
+        node_->mtime = std::uint64_t(std::time(nullptr));
+        return bytes;
+    }
+
+    bool seek(std::size_t offset, SeekType st) override {
+        // Negative offsets wrap around, same as for lseek.
+        std::size_t base = 0;
+        if(st == SCUR) base = pos_;
+        else if(st == SEND) base = node_->data.size();
+
+        auto pos = std::int64_t(base) + std::int64_t(offset);
+        if(pos < 0) return false;
+        pos_ = std::size_t(pos);
+        return true;
+    }
+
+    std::size_t tell() const override {
+        return pos_;
+    }
+};
+
+/// @brief View of a file's buffer, keeps the file alive.
+class MemoryMappedFile : public MappedFile {
+    std::shared_ptr<Node> node_;
+
+public:
+    MemoryMappedFile(std::shared_ptr<Node> node) :
+        MappedFile(node->data.data(), node->data.size()),
+        node_(std::move(node)) {}
+
+    bool isMapped() const override {
+        return true;
+    }
+};
+
+std::string key(std::string_view path) {
+    if(path.empty()) return {};
+    return normalize(path, PathStyle::posix);
+}
+
+std::string parentKey(const std::string& key) {
+    std::string_view p = parent(key, PathStyle::posix);
+    return p.empty() ? std::string(".") : std::string(p);
+}
+
+} // namespace
+
+MemoryFilesystem::MemoryFilesystem() {
+    nodes_.try_emplace(".", std::make_shared<Node>(FileType::Directory,
+                                                   nextINode_++));
+    nodes_.try_emplace("/", std::make_shared<Node>(FileType::Directory,
+                                                   nextINode_++));
+}
+
+MemoryFilesystem::~MemoryFilesystem() = default;
+
+MemoryFilesystem::Node*
+MemoryFilesystem::lookup(const std::string& key) const {
+    auto* node = nodes_.find(key);
+    return node ? node->get() : nullptr;
+}
+
+std::shared_ptr<MemoryFilesystem::Node>
+MemoryFilesystem::create(const std::string& key, FileType ft,
+                         std::error_code& ec) {
+    Node* dir = lookup(parentKey(key));
+    if(!dir) {
+        ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        return nullptr;
+    }
+    if(dir->ft != FileType::Directory) {
+        ec = std::make_error_code(std::errc::not_a_directory);
+        return nullptr;
+    }
+
+    auto node = std::make_shared<Node>(ft, nextINode_++);
+    nodes_.try_emplace(key, node);
+    dir->children.emplace_back(filename(key, PathStyle::posix));
+    dir->mtime = node->mtime;
+    return node;
+}
+
+std::error_code MemoryFilesystem::makeDirs(const std::string& key) {
+    if(Node* node = lookup(key)) {
+        if(node->ft != FileType::Directory) {
+            return std::make_error_code(std::errc::not_a_directory);
+        }
+        return {};
+    }
+    if(key.empty() || key == "..") {
+        return std::make_error_code(std::errc::no_such_file_or_directory);
+    }
+
+    if(auto ec = makeDirs(parentKey(key))) return ec;
+    std::error_code ec;
+    create(key, FileType::Directory, ec);
+    return ec;
+}
+
+void MemoryFilesystem::detach(const std::string& key) {
+    std::vector<std::string>& siblings = lookup(parentKey(key))->children;
+    siblings.erase(std::find(siblings.begin(), siblings.end(),
+                             filename(key, PathStyle::posix)));
+    nodes_.erase(key);
+}
+
+std::error_code MemoryFilesystem::addFile(std::string_view path,
+                                          std::string contents) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    if(auto ec = makeDirs(parentKey(k))) return ec;
+    if(Node* node = lookup(k)) {
+        if(node->ft == FileType::Directory) {
+            return std::make_error_code(std::errc::is_a_directory);
+        }
+        node->data = std::move(contents);
+        node->mtime = std::uint64_t(std::time(nullptr));
+        return {};
+    }
+
+    std::error_code ec;
+    if(auto node = create(k, FileType::Regular, ec)) {
+        node->data = std::move(contents);
+    }
+    return ec;
+}
+
+std::unique_ptr<File> MemoryFilesystem::open(std::string_view path,
+                                             OpenMode om,
+                                             std::error_code& ec) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    std::shared_ptr<Node> node;
+    if(auto* found = nodes_.find(k)) node = *found;
+
+    if(!node) {
+        if(!(om & OWRITE)) {
+            ec = std::make_error_code(std::errc::no_such_file_or_directory);
+            return nullptr;
+        }
+        node = create(k, FileType::Regular, ec);
+        if(!node) return nullptr;
+    }
+    else if(node->ft == FileType::Directory) {
+        ec = std::make_error_code(std::errc::is_a_directory);
+        return nullptr;
+    }
+    else if((om & OWRITE) && (om & OTRUNC)) {
+        node->data.clear();
+    }
+
+    return std::make_unique<MemoryFile>(std::move(node), om);
+}
+
+std::error_code MemoryFilesystem::rm(std::string_view path) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    Node* node = lookup(k);
+    if(!node) return std::make_error_code(std::errc::no_such_file_or_directory);
+    if(node->ft == FileType::Directory) {
+        return std::make_error_code(std::errc::is_a_directory);
+    }
+
+    detach(k);
+    return {};
+}
+
+std::error_code MemoryFilesystem::rename(std::string_view from,
+                                         std::string_view to) {
+    std::string fk = key(from);
+    std::string tk = key(to);
+    std::lock_guard lock(mutex_);
+
+    auto* found = nodes_.find(fk);
+    if(!found) {
+        return std::make_error_code(std::errc::no_such_file_or_directory);
+    }
+    std::shared_ptr<Node> node = *found;
+    if(node->ft == FileType::Directory) {
+        return std::make_error_code(std::errc::is_a_directory);
+    }
+    if(fk == tk) return {};
+
+    if(auto* old = nodes_.find(tk)) {
+        if((*old)->ft == FileType::Directory) {
+            return std::make_error_code(std::errc::is_a_directory);
+        }
+        // Open handles keep the old contents, same as a replaced inode.
+        *old = std::move(node);
+    }
+    else {
+        Node* dir = lookup(parentKey(tk));
+        if(!dir) {
+            return std::make_error_code(std::errc::no_such_file_or_directory);
+        }
+        if(dir->ft != FileType::Directory) {
+            return std::make_error_code(std::errc::not_a_directory);
+        }
+        dir->children.emplace_back(filename(tk, PathStyle::posix));
+        nodes_.try_emplace(tk, std::move(node));
+    }
+
+    detach(fk);
+    return {};
+}
+
+std::error_code MemoryFilesystem::mkdir(std::string_view path) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+    return makeDirs(k);
+}
+
+std::vector<std::string> MemoryFilesystem::listDirs(std::string_view path,
+                                                    std::error_code& ec) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    Node* node = lookup(k);
+    if(!node) {
+        ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        return {};
+    }
+    if(node->ft != FileType::Directory) {
+        ec = std::make_error_code(std::errc::not_a_directory);
+        return {};
+    }
+    return node->children;
+}
+
+FSStat MemoryFilesystem::stat(std::string_view path, std::error_code&) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    Node* node = lookup(k);
+    if(!node) return FSStat(FileType::NotFound);
+
+    bool dir = node->ft == FileType::Directory;
+    Perms perms = Perms(dir ? 0755 : 0644);
+    return FSStat(std::string(filename(k, PathStyle::posix)),
+                  UniqueID(0, node->inode), node->mtime, 0, 0,
+                  node->data.size(), node->ft, perms);
+}
+
+std::unique_ptr<MappedFile> MemoryFilesystem::map(std::string_view path,
+                                                  Advice,
+                                                  std::error_code& ec) {
+    std::string k = key(path);
+    std::lock_guard lock(mutex_);
+
+    auto* node = nodes_.find(k);
+    if(!node) {
+        ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        return nullptr;
+    }
+    if((*node)->ft == FileType::Directory) {
+        ec = std::make_error_code(std::errc::is_a_directory);
+        return nullptr;
+    }
+    return std::make_unique<MemoryMappedFile>(*node);
+}
+
+} // namespace inr::vfs
@@ -0,0 +1,159 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HSet.h>
+#include <inr/Vfs/OverlayFs.h>
+#include <inr/Vfs/Path.h>
+
+namespace inr::vfs {
+
+static bool found(const FSStat& st) {
+    return st.getFT() != FileType::NotFound && st.getFT() != FileType::None;
+}
+
+Filesystem* OverlayFilesystem::find(std::string_view path, FSStat& st,
+                                    std::error_code& ec) {
+    for(auto it = layers_.rbegin(); it != layers_.rend(); ++it) {
+        st = (*it)->stat(path, ec);
+        if(ec) return nullptr;
+        if(found(st)) return *it;
+    }
+    return nullptr;
+}
+
+std::error_code OverlayFilesystem::makeParent(std::string_view path) {
+    std::string_view dir = parent(path);
+    if(dir.empty() || top().exists(dir)) return {};
+
+    FSStat st;
+    std::error_code ec;
+    if(!find(dir, st, ec)) {
+        if(ec) return ec;
+        return std::make_error_code(std::errc::no_such_file_or_directory);
+    }
+    if(st.getFT() != FileType::Directory) {
+        return std::make_error_code(std::errc::not_a_directory);
+    }
+    return top().mkdir(dir);
+}
+
+std::unique_ptr<File> OverlayFilesystem::open(std::string_view path,
+                                              OpenMode om,
+                                              std::error_code& ec) {
+    FSStat st;
+    Filesystem* fs = find(path, st, ec);
+    if(ec) return nullptr;
+
+    if(!(om & OWRITE)) {
+        if(!fs) {
+            ec = std::make_error_code(std::errc::no_such_file_or_directory);
+            return nullptr;
+        }
+        return fs->open(path, om, ec);
+    }
+    if(fs == &top()) return top().open(path, om, ec);
+
+    if(fs && st.getFT() == FileType::Directory) {
+        ec = std::make_error_code(std::errc::is_a_directory);
+        return nullptr;
+    }
+    if((ec = makeParent(path))) return nullptr;
+
+    // Copies the lower file up, unless its contents are thrown away anyway.
+    if(fs && !(om & OTRUNC)) {
+        auto contents = fs->map(path, Advice::Sequential, ec);
+        if(!contents) return nullptr;
+
+        auto file = top().open(path, OpenMode(OWRITE | OTRUNC), ec);
+        if(!file) return nullptr;
+        if(file->write(contents->data(), contents->size()) !=
+           contents->size()) {
+            ec = std::make_error_code(std::errc::io_error);
+            return nullptr;
+        }
+    }
+    return top().open(path, om, ec);
+}
+
+std::error_code OverlayFilesystem::rm(std::string_view path) {
+    FSStat st;
+    std::error_code ec;
+    Filesystem* fs = find(path, st, ec);
+    if(ec) return ec;
+
+    if(!fs) return std::make_error_code(std::errc::no_such_file_or_directory);
+    if(fs != &top()) {
+        return std::make_error_code(std::errc::read_only_file_system);
+    }
+    return top().rm(path);
+}
+
+std::error_code OverlayFilesystem::mkdir(std::string_view path) {
+    if(auto ec = makeParent(path)) return ec;
+    return top().mkdir(path);
+}
+
+std::error_code OverlayFilesystem::rename(std::string_view from,
+                                          std::string_view to) {
+    FSStat st;
+    std::error_code ec;
+    Filesystem* fs = find(from, st, ec);
+    if(ec) return ec;
+
+    if(!fs) return std::make_error_code(std::errc::no_such_file_or_directory);
+    if(fs != &top()) {
+        return std::make_error_code(std::errc::read_only_file_system);
+    }
+    if((ec = makeParent(to))) return ec;
+    return top().rename(from, to);
+}
+
+std::vector<std::string> OverlayFilesystem::listDirs(std::string_view path,
+                                                     std::error_code& ec) {
+    std::vector<std::string> res;
+    HSet<std::string> seen;
+    bool dir = false;
+
+    for(auto it = layers_.rbegin(); it != layers_.rend(); ++it) {
+        if((*it)->stat(path, ec).getFT() != FileType::Directory) {
+            if(ec) return {};
+            continue;
+        }
+
+        dir = true;
+        for(std::string& name : (*it)->listDirs(path, ec)) {
+            if(seen.try_emplace(name).second) res.push_back(std::move(name));
+        }
+        if(ec) return {};
+    }
+
+    if(!dir) {
+        ec = std::make_error_code(exists(path)
+                                      ? std::errc::not_a_directory
+                                      : std::errc::no_such_file_or_directory);
+    }
+    return res;
+}
+
+FSStat OverlayFilesystem::stat(std::string_view path, std::error_code& ec) {
+    FSStat st;
+    if(!find(path, st, ec)) return FSStat(ec ? FileType::None
+                                             : FileType::NotFound);
+    return st;
+}
+
+std::unique_ptr<MappedFile> OverlayFilesystem::map(std::string_view path,
+                                                   Advice advice,
+                                                   std::error_code& ec) {
+    FSStat st;
+    Filesystem* fs = find(path, st, ec);
+    if(!fs) {
+        if(!ec) {
+            ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        }
+        return nullptr;
+    }
+    return fs->map(path, advice, ec);
+}
+
+} // namespace inr::vfs
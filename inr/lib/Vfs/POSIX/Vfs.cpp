@@ -4,14 +4,20 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <inr/Vfs/Vfs.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 #include <system_error>
 
+#include "Walk.h"
+
 namespace inr::vfs {
 
 class BasePosixFile : public File {
@@ -39,6 +45,64 @@ public:
         off_t res = ::lseek(fd_, 0, SEEK_CUR);
         return (res == -1) ? 0 : std::size_t(res);
     }
+
+    std::size_t readv(arrview<IOVec> vecs) override {
+        return vectored(vecs, [this](const struct iovec* iov, int n) {
+            return ::readv(fd_, iov, n);
+        });
+    }
+
+    std::size_t writev(arrview<ConstIOVec> vecs) override {
+        return vectored(vecs, [this](const struct iovec* iov, int n) {
+            return ::writev(fd_, iov, n);
+        });
+    }
+
+    std::size_t pread(void* buffer, std::size_t bytes,
+                      std::size_t offset) override {
+        ssize_t res = ::pread(fd_, buffer, bytes, off_t(offset));
+        return (res < 0) ? 0 : std::size_t(res);
+    }
+
+    std::size_t pwrite(const void* buffer, std::size_t bytes,
+                       std::size_t offset) override {
+        ssize_t res = ::pwrite(fd_, buffer, bytes, off_t(offset));
+        return (res < 0) ? 0 : std::size_t(res);
+    }
+
+    std::error_code sync() override {
+        // The data and the size, the rest of the metadata can wait.
+        if(::fdatasync(fd_) == -1) {
+            return std::make_error_code(std::errc(errno));
+        }
+        return {};
+    }
+
+private:
+    /// @brief Converts the buffers to iovecs a chunk at a time and passes them
+    /// to `syscall`, stops at a short transfer.
+    template<typename Vec, typename Syscall>
+    static std::size_t vectored(arrview<Vec> vecs, Syscall syscall) {
+        constexpr std::size_t CHUNK = 64;
+        struct iovec iov[CHUNK];
+
+        std::size_t total = 0;
+        for(std::size_t i = 0; i < vecs.size(); i += CHUNK) {
+            std::size_t n = std::min(CHUNK, vecs.size() - i);
+            std::size_t expected = 0;
+            for(std::size_t j = 0; j < n; j++) {
+                iov[j].iov_base = const_cast<void*>(vecs[i + j].data);
+                iov[j].iov_len = vecs[i + j].size;
+                expected += vecs[i + j].size;
+            }
+
+            ssize_t res = syscall(iov, int(n));
+            if(res < 0) break;
+            total += std::size_t(res);
+            if(std::size_t(res) != expected) break;
+        }
+        return total;
+    }
 };
 
 class PosixFile : public BasePosixFile {
@@ -50,7 +114,205 @@ public:
     }
 };
 
+/// @brief A file that had space reserved past its end, trims what wasn't
+/// written when it's synced or closed.
+class PreallocatedFile : public PosixFile {
+    std::size_t reserved_;
+
+    void trim() {
+        struct ::stat st;
+        if(::fstat(fd_, &st) == 0 && std::size_t(st.st_size) < reserved_) {
+            ::ftruncate(fd_, st.st_size);
+        }
+    }
+
+public:
+    PreallocatedFile(int fd, std::size_t reserved) :
+        PosixFile(fd), reserved_(reserved) {}
+
+    ~PreallocatedFile() override {
+        trim();
+    }
+
+    /// @brief Trims first, so the synced blocks are the ones kept.
+    std::error_code sync() override {
+        trim();
+        return PosixFile::sync();
+    }
+};
+
+class PosixMappedFile : public MappedFile {
+public:
+    PosixMappedFile(const char* data, std::size_t size) :
+        MappedFile(data, size) {}
+
+    ~PosixMappedFile() override {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    bool isMapped() const override {
+        return true;
+    }
+
+    void advise(Advice advice) override {
+        int adv = MADV_NORMAL;
+        switch(advice) {
+            case Advice::Normal:
+                adv = MADV_NORMAL;
+                break;
+            case Advice::Sequential:
+                adv = MADV_SEQUENTIAL;
+                break;
+            case Advice::Random:
+                adv = MADV_RANDOM;
+                break;
+        }
+        // Only a hint, failing is harmless.
+        ::madvise(const_cast<char*>(data_), size_, adv);
+    }
+};
+
+static FileType fileType(mode_t mode) {
+    if(S_ISREG(mode)) return FileType::Regular;
+    if(S_ISDIR(mode)) return FileType::Directory;
+    if(S_ISLNK(mode)) return FileType::Symlink;
+    if(S_ISFIFO(mode)) return FileType::FIFO;
+    if(S_ISSOCK(mode)) return FileType::Socket;
+    if(S_ISCHR(mode)) return FileType::CharacterDevice;
+    return FileType::None;
+}
+
+/// @brief Returns the type readdir gave, None if it doesn't know it.
+static FileType fileType(const struct dirent* entry) {
+#ifdef DT_UNKNOWN
+    switch(entry->d_type) {
+        case DT_REG:
+            return FileType::Regular;
+        case DT_DIR:
+            return FileType::Directory;
+        case DT_LNK:
+            return FileType::Symlink;
+        case DT_FIFO:
+            return FileType::FIFO;
+        case DT_SOCK:
+            return FileType::Socket;
+        case DT_CHR:
+            return FileType::CharacterDevice;
+        default:
+            break;
+    }
+#endif
+    return FileType::None;
+}
+
 class PosixFilesystem : public Filesystem {
+    /// @brief Files smaller than this are read, a few pages are cheaper to
+    /// copy than to map and unmap.
+    static constexpr std::size_t MIN_MAP_SIZE = 16 * 1024;
+
+    /// @brief Walks the directory open at `fd` and closes it, returns false
+    /// if the walk ended. Without `DirentTypes` every entry is stat'd, as if
+    /// the filesystem didn't fill in d_type.
+    template<bool DirentTypes>
+    static bool walkDir(int fd, std::string& path, unsigned depth,
+                        DirVisitor& visitor, std::error_code& ec) {
+        DIR* dir = ::fdopendir(fd);
+        if(!dir) {
+            ec = std::make_error_code(std::errc(errno));
+            ::close(fd);
+            return false;
+        }
+
+        std::size_t base = path.size();
+        bool going = true;
+        while(going) {
+            errno = 0;
+            struct dirent* entry = ::readdir(dir);
+            if(!entry) {
+                if(errno) ec = std::make_error_code(std::errc(errno));
+                going = !errno;
+                break;
+            }
+
+            std::string_view name(entry->d_name);
+            if(name == "." || name == "..") continue;
+
+            // Only some filesystems fill in d_type, stat the rest.
+            FileType ft = FileType::None;
+            if constexpr(DirentTypes) ft = fileType(entry);
+            if(ft == FileType::None) {
+                struct ::stat st;
+                if(::fstatat(fd, entry->d_name, &st, AT_SYMLINK_NOFOLLOW)) {
+                    // Removed since it was listed.
+                    if(errno == ENOENT) continue;
+                    ec = std::make_error_code(std::errc(errno));
+                    going = false;
+                    break;
+                }
+                ft = fileType(st.st_mode);
+            }
+
+            path.resize(base);
+            if(!path.empty() && path.back() != '/') path += '/';
+            path += name;
+
+            std::string_view entryPath(path);
+            WalkAction action = visitor.visit(DirEntry(
+                entryPath, entryPath.substr(path.size() - name.size()), ft,
+                depth));
+            if(action == WalkAction::Stop) {
+                going = false;
+                break;
+            }
+            if(action != WalkAction::Continue || ft != FileType::Directory) {
+                continue;
+            }
+
+            int sub = ::openat(fd, entry->d_name,
+                               O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            if(sub == -1) {
+                ec = std::make_error_code(std::errc(errno));
+                going = false;
+                break;
+            }
+            going =
+                walkDir<DirentTypes>(sub, path, depth + 1, visitor, ec);
+        }
+
+        path.resize(base);
+        ::closedir(dir);
+        return going;
+    }
+
+    /// @brief Reserves `size` bytes for the file without changing its size,
+    /// returns false if it couldn't.
+    /// @note posix_fallocate would grow the file, and a shorter output would
+    /// have to be truncated, only Linux can reserve past the end.
+    static bool preallocate(int fd, std::size_t size) {
+#ifdef FALLOC_FL_KEEP_SIZE
+        return ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, off_t(size)) == 0;
+#else
+        (void)fd;
+        (void)size;
+        return false;
+#endif
+    }
+
+    template<bool DirentTypes>
+    static std::error_code walkPath(std::string_view path,
+                                    DirVisitor& visitor) {
+        std::string path_str(path);
+        int fd = ::open(path_str.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(fd == -1) return std::make_error_code(std::errc(errno));
+
+        std::error_code ec;
+        walkDir<DirentTypes>(fd, path_str, 0, visitor, ec);
+        return ec;
+    }
+
+    friend std::error_code walkUntyped(std::string_view path,
+                                       DirVisitor& visitor);
+
 public:
     std::unique_ptr<File> open(std::string_view path, OpenMode om,
                                std::error_code& ec) override {
@@ -121,13 +383,7 @@ public:
             return FSStat(FileType::None);
         }
 
-        FileType ft = FileType::None;
-        if(S_ISREG(st.st_mode)) ft = FileType::Regular;
-        else if(S_ISDIR(st.st_mode)) ft = FileType::Directory;
-        else if(S_ISLNK(st.st_mode)) ft = FileType::Symlink;
-        else if(S_ISFIFO(st.st_mode)) ft = FileType::FIFO;
-        else if(S_ISSOCK(st.st_mode)) ft = FileType::Socket;
-        else if(S_ISCHR(st.st_mode)) ft = FileType::CharacterDevice;
+        FileType ft = fileType(st.st_mode);
 
         UniqueID uid{uint64_t(st.st_dev), uint64_t(st.st_ino)};
         Perms perms = Perms(st.st_mode & mode_t(Perms::All));
@@ -137,6 +393,106 @@ public:
         return FSStat(name, uid, uint64_t(st.st_mtime), uint32_t(st.st_uid),
                       uint32_t(st.st_gid), uint64_t(st.st_size), ft, perms);
     }
+
+    std::error_code walk(std::string_view path,
+                         DirVisitor& visitor) override {
+        return walkPath<true>(path, visitor);
+    }
+
+    std::error_code rename(std::string_view from,
+                           std::string_view to) override {
+        std::string from_str(from);
+        std::string to_str(to);
+        if(::rename(from_str.c_str(), to_str.c_str()) == -1) {
+            return std::make_error_code(std::errc(errno));
+        }
+
+        // The rename is only durable once the directory is synced. It's done
+        // by now, so a directory that can't be opened or synced doesn't fail
+        // it.
+        std::string dir(parent(to, PathStyle::posix));
+        if(dir.empty()) dir = ".";
+        int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(fd != -1) {
+            ::fsync(fd);
+            ::close(fd);
+        }
+        return {};
+    }
+
+    std::unique_ptr<OutputFile> createOutput(std::string_view path,
+                                             std::size_t sizeHint,
+                                             std::error_code& ec) override {
+        std::string tempPath;
+        int fd;
+        // Another process may have picked the same name, O_EXCL never
+        // shares the file.
+        do {
+            tempPath = tempSibling(path);
+            fd = ::open(tempPath.c_str(),
+                        O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+        } while(fd == -1 && errno == EEXIST);
+        if(fd == -1) {
+            ec = std::make_error_code(std::errc(errno));
+            return nullptr;
+        }
+
+        // The file it replaces keeps its permissions, a new one gets the
+        // umask's.
+        std::string path_str(path);
+        struct ::stat st;
+        if(::stat(path_str.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            ::fchmod(fd, st.st_mode & 07777);
+        }
+
+        // The reservation is only a hint, the file grows as usual without it.
+        std::unique_ptr<File> file;
+        if(sizeHint && preallocate(fd, sizeHint)) {
+            file = std::make_unique<PreallocatedFile>(fd, sizeHint);
+        }
+        else {
+            file = std::make_unique<PosixFile>(fd);
+        }
+        return std::make_unique<OutputFile>(*this, std::move(file),
+                                            std::string(path),
+                                            std::move(tempPath));
+    }
+
+    std::unique_ptr<MappedFile> map(std::string_view path, Advice advice,
+                                    std::error_code& ec) override {
+        std::string path_str(path);
+        int fd = ::open(path_str.c_str(), O_RDONLY);
+        if(fd == -1) {
+            ec = std::make_error_code(std::errc(errno));
+            return nullptr;
+        }
+        PosixFile file(fd);
+
+        struct ::stat st;
+        if(::fstat(fd, &st) == -1) {
+            ec = std::make_error_code(std::errc(errno));
+            return nullptr;
+        }
+        if(S_ISDIR(st.st_mode)) {
+            ec = std::make_error_code(std::errc::is_a_directory);
+            return nullptr;
+        }
+
+        // Pipes and devices can't be mapped, their size isn't known either.
+        std::size_t size = S_ISREG(st.st_mode) ? std::size_t(st.st_size) : 0;
+        if(!S_ISREG(st.st_mode) || size < MIN_MAP_SIZE) {
+            return readAll(file, size);
+        }
+
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data == MAP_FAILED) return readAll(file, size);
+
+        // The mapping keeps the file alive, the descriptor can be closed.
+        auto mapped =
+            std::make_unique<PosixMappedFile>(static_cast<char*>(data), size);
+        if(advice != Advice::Normal) mapped->advise(advice);
+        return mapped;
+    }
 };
 
 Filesystem& getNativeFs() {
@@ -144,6 +500,10 @@ Filesystem& getNativeFs() {
     return fs;
 }
 
+std::error_code walkUntyped(std::string_view path, DirVisitor& visitor) {
+    return PosixFilesystem::walkPath<false>(path, visitor);
+}
+
 std::unique_ptr<File> getStdout() {
     return std::make_unique<BasePosixFile>(STDOUT_FILENO);
 }
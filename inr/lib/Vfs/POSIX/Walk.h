@@ -0,0 +1,24 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef INERTIA_VFS_POSIX_WALK
+#define INERTIA_VFS_POSIX_WALK
+
+/// @file POSIX/Walk.h
+/// @brief Provides the native walk's internals to the tests.
+
+#include <inr/Vfs/Vfs.h>
+
+#include <string_view>
+#include <system_error>
+
+namespace inr::vfs {
+
+/// @brief Walks like the native fs, but ignores d_type and stats every entry,
+/// as it does on filesystems that don't fill it in.
+std::error_code walkUntyped(std::string_view path, DirVisitor& visitor);
+
+} // namespace inr::vfs
+
+#endif // INERTIA_VFS_POSIX_WALK
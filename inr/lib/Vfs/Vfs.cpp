@@ -1,6 +1,283 @@
 // Copyright (c) 2026 Inertia Project
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Vfs/Vfs.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
 #ifdef __unix__
 #include "POSIX/Vfs.cpp"
 #endif
+
+namespace inr::vfs {
+
+namespace {
+
+/// @brief File contents copied into memory.
+class BufferedFile : public MappedFile {
+    std::string buffer_;
+
+public:
+    BufferedFile(std::string buffer) :
+        MappedFile(nullptr, 0), buffer_(std::move(buffer)) {
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+};
+
+/// @brief Walks the directory at `path`, returns false if the walk ended.
+/// `parents` are the directories being walked, to not loop on symlinks.
+bool walkListed(Filesystem& fs, std::string& path, unsigned depth,
+                DirVisitor& visitor, std::vector<UniqueID>& parents,
+                std::error_code& ec) {
+    std::vector<std::string> names = fs.listDirs(path, ec);
+    if(ec) return false;
+
+    std::size_t base = path.size();
+    for(const std::string& name : names) {
+        path.resize(base);
+        if(!path.empty() && path.back() != '/') path += '/';
+        path += name;
+
+        FSStat st = fs.stat(path, ec);
+        if(ec) return false;
+        // Removed since it was listed.
+        if(st.getFT() == FileType::NotFound) continue;
+
+        std::string_view entryPath(path);
+        DirEntry entry(entryPath, entryPath.substr(path.size() - name.size()),
+                       st.getFT(), depth);
+        WalkAction action = visitor.visit(entry);
+        if(action == WalkAction::Stop) return false;
+        if(action != WalkAction::Continue ||
+           st.getFT() != FileType::Directory ||
+           std::find(parents.begin(), parents.end(), st.getUID()) !=
+               parents.end()) {
+            continue;
+        }
+
+        parents.push_back(st.getUID());
+        if(!walkListed(fs, path, depth + 1, visitor, parents, ec)) {
+            return false;
+        }
+        parents.pop_back();
+    }
+    path.resize(base);
+    return true;
+}
+
+} // namespace
+
+std::size_t File::readv(arrview<IOVec> vecs) {
+    std::size_t total = 0;
+    for(const IOVec& vec : vecs) {
+        std::size_t b = read(vec.data, vec.size);
+        total += b;
+        if(b != vec.size) break;
+    }
+    return total;
+}
+
+std::size_t File::writev(arrview<ConstIOVec> vecs) {
+    std::size_t total = 0;
+    for(const ConstIOVec& vec : vecs) {
+        std::size_t b = write(vec.data, vec.size);
+        total += b;
+        if(b != vec.size) break;
+    }
+    return total;
+}
+
+std::size_t File::pread(void* buffer, std::size_t bytes,
+                        std::size_t offset) {
+    std::size_t pos = tell();
+    if(!seek(offset, SSET)) return 0;
+    std::size_t b = read(buffer, bytes);
+    seek(pos, SSET);
+    return b;
+}
+
+std::size_t File::pwrite(const void* buffer, std::size_t bytes,
+                         std::size_t offset) {
+    std::size_t pos = tell();
+    if(!seek(offset, SSET)) return 0;
+    std::size_t b = write(buffer, bytes);
+    seek(pos, SSET);
+    return b;
+}
+
+OutputFile::OutputFile(Filesystem& fs, std::unique_ptr<File> file,
+                       std::string path, std::string tempPath) :
+    fs_(&fs), file_(std::move(file)), path_(std::move(path)),
+    tempPath_(std::move(tempPath)) {}
+
+OutputFile::~OutputFile() {
+    abort();
+}
+
+std::size_t OutputFile::read(void* buffer, std::size_t bytes) {
+    return file_ ? file_->read(buffer, bytes) : 0;
+}
+
+std::size_t OutputFile::write(const void* buffer, std::size_t bytes) {
+    if(!file_) return 0;
+    std::size_t b = file_->write(buffer, bytes);
+    if(b != bytes) failed_ = true;
+    return b;
+}
+
+bool OutputFile::seek(std::size_t offset, SeekType st) {
+    return file_ && file_->seek(offset, st);
+}
+
+std::size_t OutputFile::tell() const {
+    return file_ ? file_->tell() : 0;
+}
+
+std::size_t OutputFile::readv(arrview<IOVec> vecs) {
+    return file_ ? file_->readv(vecs) : 0;
+}
+
+std::size_t OutputFile::writev(arrview<ConstIOVec> vecs) {
+    if(!file_) return 0;
+    std::size_t expected = 0;
+    for(const ConstIOVec& vec : vecs) expected += vec.size;
+    std::size_t b = file_->writev(vecs);
+    if(b != expected) failed_ = true;
+    return b;
+}
+
+std::size_t OutputFile::pread(void* buffer, std::size_t bytes,
+                              std::size_t offset) {
+    return file_ ? file_->pread(buffer, bytes, offset) : 0;
+}
+
+std::size_t OutputFile::pwrite(const void* buffer, std::size_t bytes,
+                               std::size_t offset) {
+    if(!file_) return 0;
+    std::size_t b = file_->pwrite(buffer, bytes, offset);
+    if(b != bytes) failed_ = true;
+    return b;
+}
+
+std::error_code OutputFile::sync() {
+    if(!file_) return std::make_error_code(std::errc::bad_file_descriptor);
+    return file_->sync();
+}
+
+std::error_code OutputFile::commit() {
+    if(!file_) return std::make_error_code(std::errc::bad_file_descriptor);
+
+    // Synced and closed first, so everything is written by the time it's
+    // visible, and a crash can't publish a file whose data never made it.
+    std::error_code ec;
+    if(failed_) ec = std::make_error_code(std::errc::io_error);
+    else ec = file_->sync();
+    file_.reset();
+
+    if(!ec) ec = fs_->rename(tempPath_, path_);
+    if(ec) fs_->rm(tempPath_);
+    return ec;
+}
+
+void OutputFile::abort() {
+    if(!file_) return;
+    file_.reset();
+    fs_->rm(tempPath_);
+}
+
+std::string Filesystem::tempSibling(std::string_view path) {
+    // Starts at a random number, so other processes pick other names.
+    static std::atomic<std::uint32_t> counter{std::random_device{}()};
+
+    std::string res(path);
+    res += ".tmp";
+    res += std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+    return res;
+}
+
+std::unique_ptr<MappedFile> Filesystem::readAll(File& file,
+                                                std::size_t sizeHint) {
+    // One byte more than expected, so a file of the right size is read in one
+    // go and the next read returns 0.
+    std::string buffer(sizeHint + 1, '\0');
+    std::size_t size = 0;
+    while(std::size_t b =
+              file.read(buffer.data() + size, buffer.size() - size)) {
+        size += b;
+        if(size == buffer.size()) buffer.resize(buffer.size() * 2);
+    }
+    buffer.resize(size);
+    return std::make_unique<BufferedFile>(std::move(buffer));
+}
+
+std::unique_ptr<MappedFile> Filesystem::map(std::string_view path, Advice,
+                                            std::error_code& ec) {
+    FSStat st = stat(path, ec);
+    if(ec) return nullptr;
+
+    switch(st.getFT()) {
+        case FileType::None:
+        case FileType::NotFound:
+            ec = std::make_error_code(std::errc::no_such_file_or_directory);
+            return nullptr;
+        case FileType::Directory:
+            ec = std::make_error_code(std::errc::is_a_directory);
+            return nullptr;
+        default:
+            break;
+    }
+
+    auto file = open(path, OREAD, ec);
+    if(!file) return nullptr;
+    return readAll(*file, st.getSize());
+}
+
+std::error_code Filesystem::rename(std::string_view from,
+                                   std::string_view to) {
+    std::error_code ec;
+    auto contents = map(from, Advice::Sequential, ec);
+    if(!contents) return ec;
+
+    auto file = open(to, OpenMode(OWRITE | OTRUNC), ec);
+    if(!file) return ec;
+    if(file->write(contents->data(), contents->size()) != contents->size()) {
+        return std::make_error_code(std::errc::io_error);
+    }
+    file.reset();
+    contents.reset();
+
+    // `to` is in place, failing to remove `from` only leaves a copy behind.
+    rm(from);
+    return {};
+}
+
+std::unique_ptr<OutputFile> Filesystem::createOutput(std::string_view path,
+                                                     std::size_t,
+                                                     std::error_code& ec) {
+    std::string tempPath = tempSibling(path);
+    auto file = open(tempPath, OpenMode(OWRITE | OTRUNC), ec);
+    if(!file) return nullptr;
+    return std::make_unique<OutputFile>(*this, std::move(file),
+                                        std::string(path),
+                                        std::move(tempPath));
+}
+
+std::error_code Filesystem::walk(std::string_view path, DirVisitor& visitor) {
+    std::error_code ec;
+    FSStat st = stat(path, ec);
+    if(ec) return ec;
+
+    std::string buffer(path);
+    std::vector<UniqueID> parents{st.getUID()};
+    walkListed(*this, buffer, 0, visitor, parents, ec);
+    return ec;
+}
+
+} // namespace inr::vfs
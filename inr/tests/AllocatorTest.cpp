@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Support/Allocator.h>
+#include <inr/Support/Stream.h>
+
+#include <cstddef>
+#include <cstdint>
+
+int bumpAllocatorTest() {
+    inr::BumpAllocator alloc(0x1000);
+
+    if(alloc.getSlabCount() != 0) {
+        inr::err() << "Allocator shouldn't allocate before it's used\n";
+        return 1;
+    }
+
+    for(unsigned i = 0; i < 0x1000; i++) {
+        std::size_t align = std::size_t(1) << (i % 7);
+        void* ptr = alloc.allocate(i % 24 + 1, align);
+        if(std::uintptr_t(ptr) % align) {
+            inr::err() << "Misaligned allocation at index: " << i << '\n';
+            return 1;
+        }
+    }
+
+    std::size_t slabs = alloc.getSlabCount();
+
+    // Bigger than half of a slab, should get a slab of its own.
+    auto big = alloc.allocate<uint64_t>(0x400);
+    big[0x3FF] = 42;
+    if(alloc.getSlabCount() != slabs + 1) {
+        inr::err() << "Big allocation should get its own slab\n";
+        return 1;
+    }
+
+    auto val = alloc.create<uint64_t>(42);
+    if(*val != 42) return 1;
+
+    if(alloc.getBytesAllocated() > alloc.getBytesReserved()) {
+        inr::err() << "Allocated more bytes than reserved\n";
+        return 1;
+    }
+
+    alloc.reset();
+    if(alloc.getSlabCount() || alloc.getBytesAllocated() ||
+       alloc.getBytesReserved()) {
+        inr::err() << "Reset should free everything\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int unitArenaTest() {
+    inr::TUnit unit("AllocatorTest.cpp");
+    inr::TypeMap tm;
+
+    if(unit.getAllocator().getBytesAllocated() != 0) {
+        inr::err() << "Empty unit shouldn't allocate\n";
+        return 1;
+    }
+
+    auto fn = unit.createFunction(tm.getFunc(tm.getI32(), {tm.getI32()}, false),
+                                  "fn", inr::Linkage::Global,
+                                  inr::TypeExt::NoExt);
+    auto entry = unit.createBlock(tm, fn, "entry");
+
+    if(entry->getParent() != fn || fn->getParent() != &unit) {
+        inr::err() << "Parents are not set correctly\n";
+        return 1;
+    }
+
+    inr::Def* acc = fn->getArg(0);
+    for(unsigned i = 0; i < 0x1000; i++) {
+        acc = inr::AddInst::createAdd(
+            entry, acc, unit.createConst(tm.getI32(), inr::bigint(32, i)));
+    }
+    // Wide constants own heap memory, their destructors must still run.
+    unit.createConst(tm.getInt(256), inr::bigint(256, 42));
+    inr::RetInst::createRet(tm, entry, acc);
+
+    if(unit.getAllocator().getBytesAllocated() <
+       0x1000 * sizeof(inr::AddInst)) {
+        inr::err() << "Instructions should be allocated from the unit\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    if(int res = bumpAllocatorTest()) return res;
+    if(int res = unitArenaTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/BitOps.h>
+#include <inr/ADT/BitVector.h>
+#include <inr/ADT/SmallBitVector.h>
+#include <inr/ADT/SparseBitVector.h>
+#include <inr/Support/Stream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+static std::uint32_t seed = 42;
+
+static std::uint32_t nextRandom() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+/// @brief Fills `bv` and `ref` with the same random bits.
+template<typename BV>
+static void fill(BV& bv, std::vector<bool>& ref, unsigned density) {
+    for(std::size_t i = 0; i < ref.size(); i++) {
+        bool bit = nextRandom() % 100 < density;
+        ref[i] = bit;
+        if(bit) bv.set(i);
+    }
+}
+
+template<typename BV>
+static bool matches(const BV& bv, const std::vector<bool>& ref) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < ref.size(); i++) {
+        if(bv.test(i) != ref[i]) return false;
+        count += ref[i];
+    }
+    if(bv.count() != count) return false;
+
+    // The iterator and the find functions visit exactly the set bits.
+    std::size_t prev = 0;
+    std::size_t visited = 0;
+    for(std::size_t i : bv.set_bits()) {
+        if(!ref[i] || (visited && i <= prev)) return false;
+        prev = i;
+        visited++;
+    }
+    if(visited != count) return false;
+
+    visited = 0;
+    for(std::size_t i = bv.find_first(); i != BV::npos; i = bv.find_next(i)) {
+        visited++;
+    }
+    return visited == count;
+}
+
+template<typename BV>
+static int denseTest(std::size_t bits) {
+    std::vector<bool> refA(bits), refB(bits);
+    BV a(bits), b(bits);
+    fill(a, refA, 30);
+    fill(b, refB, 50);
+    if(!matches(a, refA) || !matches(b, refB)) {
+        inr::err() << "Bits differ after filling, size: " << bits << '\n';
+        return 1;
+    }
+
+    bool common = false;
+    for(std::size_t i = 0; i < bits; i++) common |= refA[i] && refB[i];
+    if(a.anyCommon(b) != common) return 1;
+
+    BV u = a;
+    std::vector<bool> refU = refA;
+    bool changed = false;
+    for(std::size_t i = 0; i < bits; i++) {
+        changed |= refB[i] && !refU[i];
+        refU[i] = refU[i] || refB[i];
+    }
+    if(u.unionWith(b) != changed || !matches(u, refU)) {
+        inr::err() << "Union is wrong, size: " << bits << '\n';
+        return 1;
+    }
+    if(u.unionWith(b)) return 1;
+
+    BV n = a;
+    std::vector<bool> refN = refA;
+    for(std::size_t i = 0; i < bits; i++) refN[i] = refN[i] && refB[i];
+    n &= b;
+    if(!matches(n, refN)) {
+        inr::err() << "Intersection is wrong, size: " << bits << '\n';
+        return 1;
+    }
+
+    BV d = a;
+    std::vector<bool> refD = refA;
+    for(std::size_t i = 0; i < bits; i++) refD[i] = refD[i] && !refB[i];
+    d -= b;
+    if(!matches(d, refD)) {
+        inr::err() << "Difference is wrong, size: " << bits << '\n';
+        return 1;
+    }
+
+    // Growing with set bits must not resurrect bits past the old size.
+    BV g(bits);
+    g.resize(bits + 70, true);
+    if(g.count() != 70 || (bits && g.test(bits - 1))) return 1;
+    g.resize(bits / 2);
+    g.resize(bits + 70);
+    if(g.count() != 0) return 1;
+
+    if(!(a == a) || (bits > 64 && a == b)) return 1;
+    return 0;
+}
+
+static int kernelTest() {
+    // Odd lengths exercise the vector loops and the scalar tail.
+    for(std::size_t n = 0; n < 19; n++) {
+        std::vector<inr::BitWord> a(n), b(n);
+        for(std::size_t i = 0; i < n; i++) {
+            a[i] = (inr::BitWord(nextRandom()) << 32) | nextRandom();
+            b[i] = (inr::BitWord(nextRandom()) << 32) | nextRandom();
+        }
+
+        std::vector<inr::BitWord> scalar = a, simd = a;
+        bool sc = inr::internal::applyWordsScalar<inr::internal::BitAndNot>(
+            scalar.data(), b.data(), n);
+        bool vc = inr::internal::applyWords<inr::internal::BitAndNot>(
+            simd.data(), b.data(), n);
+        if(sc != vc || scalar != simd) {
+            inr::err() << "SIMD kernel differs from scalar, words: " << n
+                       << '\n';
+            return 1;
+        }
+
+        // A change in only the last word must still be reported.
+        if(n) {
+            std::vector<inr::BitWord> zero(n), last(n);
+            last[n - 1] = 1;
+            if(!inr::internal::applyWords<inr::internal::BitOr>(
+                   zero.data(), last.data(), n))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+static int smallTest() {
+    inr::SmallBitVector<64> small(40);
+    small.set(3).set(39);
+    if(!small.isSmall() || small.count() != 2) return 1;
+
+    small.resize(200, true);
+    if(small.isSmall() || !small.test(3) || !small.test(39) ||
+       small.test(38) || small.count() != 162)
+        return 1;
+
+    inr::SmallBitVector<64> moved(std::move(small));
+    if(moved.count() != 162 || !small.empty()) return 1;
+
+    return 0;
+}
+
+static int sparseTest() {
+    inr::SparseBitVector a, b;
+    std::set<std::size_t> refA, refB;
+
+    for(unsigned i = 0; i < 200; i++) {
+        std::size_t n = nextRandom() % 100000;
+        if(a.set(n) != refA.insert(n).second) return 1;
+        n = nextRandom() % 100000;
+        b.set(n);
+        refB.insert(n);
+    }
+    // Overlap on purpose, within and across elements.
+    for(std::size_t n : {5, 130, 131, 99999}) {
+        a.set(n);
+        refA.insert(n);
+        b.set(n);
+        refB.insert(n);
+    }
+
+    auto same = [](const inr::SparseBitVector& bv,
+                   const std::set<std::size_t>& ref) {
+        if(bv.count() != ref.size()) return false;
+        auto it = ref.begin();
+        for(std::size_t i : bv) {
+            if(it == ref.end() || *it != i) return false;
+            ++it;
+        }
+        if(it != ref.end()) return false;
+        return ref.empty() || bv.find_first() == *ref.begin();
+    };
+    if(!same(a, refA) || !same(b, refB)) return 1;
+
+    inr::SparseBitVector u = a;
+    std::set<std::size_t> refU = refA;
+    refU.insert(refB.begin(), refB.end());
+    if(!u.unionWith(b) || !same(u, refU) || u.unionWith(b)) {
+        inr::err() << "Sparse union is wrong\n";
+        return 1;
+    }
+
+    inr::SparseBitVector n = a;
+    std::set<std::size_t> refN;
+    for(std::size_t i : refA) {
+        if(refB.count(i)) refN.insert(i);
+    }
+    n &= b;
+    if(!same(n, refN) || !a.anyCommon(b)) {
+        inr::err() << "Sparse intersection is wrong\n";
+        return 1;
+    }
+
+    inr::SparseBitVector d = a;
+    std::set<std::size_t> refD;
+    for(std::size_t i : refA) {
+        if(!refB.count(i)) refD.insert(i);
+    }
+    d -= b;
+    if(!same(d, refD) || d.anyCommon(b)) {
+        inr::err() << "Sparse difference is wrong\n";
+        return 1;
+    }
+
+    for(std::size_t i : refA) {
+        if(!a.reset(i)) return 1;
+    }
+    if(!a.empty() || a.reset(5)) return 1;
+
+    return 0;
+}
+
+int main() {
+    for(std::size_t bits : {0, 1, 63, 64, 65, 200, 1000, 4099}) {
+        if(int res = denseTest<inr::BitVector>(bits)) return res;
+        if(int res = denseTest<inr::SmallBitVector<128>>(bits)) return res;
+    }
+    if(int res = kernelTest()) return res;
+    if(int res = smallTest()) return res;
+    if(int res = sparseTest()) return res;
+
+    return 0;
+}
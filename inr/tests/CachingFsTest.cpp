@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/StrStream.h>
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/CachingFs.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+/// @brief Counts the stats that reach the filesystem.
+class CountingFs : public inr::vfs::MemoryFilesystem {
+public:
+    std::size_t stats = 0;
+    /// @brief Runs after the next stat, before its result is returned.
+    std::function<void()> afterStat;
+
+    inr::vfs::FSStat stat(std::string_view path,
+                          std::error_code& ec) override {
+        stats++;
+        inr::vfs::FSStat st = MemoryFilesystem::stat(path, ec);
+        if(afterStat) std::exchange(afterStat, nullptr)();
+        return st;
+    }
+};
+
+static std::size_t sizeOf(inr::vfs::Filesystem& fs, std::string_view path) {
+    std::error_code ec;
+    return fs.stat(path, ec).getSize();
+}
+
+/// @brief Renames a directory whose entries are cached, memory filesystems
+/// can't rename directories so it goes through the native one.
+static int renameDirTest() {
+    inr::vfs::CachingFilesystem fs(inr::vfs::getNativeFs());
+    std::error_code ec;
+    if(fs.mkdir("cache_dir") ||
+       !fs.open("cache_dir/f",
+                inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec)) {
+        return 1;
+    }
+
+    int res = 0;
+    if(!fs.exists("cache_dir/f") || fs.exists("cache_moved/f") ||
+       fs.rename("cache_dir", "cache_moved") || fs.exists("cache_dir/f") ||
+       !fs.exists("cache_moved/f")) {
+        inr::err() << "Renaming a directory left its entries cached\n";
+        res = 1;
+    }
+
+    std::filesystem::remove_all("cache_dir", ec);
+    std::filesystem::remove_all("cache_moved", ec);
+    return res;
+}
+
+int main() {
+    if(int res = renameDirTest()) return res;
+
+    CountingFs mem;
+    inr::vfs::CachingFilesystem fs(mem);
+    std::error_code ec;
+
+    if(mem.addFile("inc/a.h", "int a;")) return 1;
+
+    // Repeated lookups, of any spelling of the path, only stat once.
+    for(std::string_view path : {"inc/a.h", "./inc/a.h", "inc//a.h",
+                                 "inc/../inc/a.h"}) {
+        if(sizeOf(fs, path) != 6 || !fs.exists(path)) {
+            inr::err() << "Wrong stat for '" << path << "'\n";
+            return 1;
+        }
+    }
+    if(mem.stats != 1 || fs.getHits() != 7 || fs.getMisses() != 1) {
+        inr::err() << "Stat wasn't cached, " << mem.stats << " stats\n";
+        return 1;
+    }
+
+    // Missing paths are remembered, even for opening and mapping.
+    if(fs.exists("inc/b.h") || fs.exists("inc/b.h") ||
+       fs.open("inc/b.h", inr::vfs::OREAD, ec) ||
+       ec != std::errc::no_such_file_or_directory ||
+       fs.map("inc/b.h", inr::vfs::Advice::Normal, ec) || mem.stats != 2) {
+        inr::err() << "Missing path wasn't cached\n";
+        return 1;
+    }
+
+    // Creating it through the cache makes it visible.
+    {
+        auto f = fs.open(
+            "inc/b.h", inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC),
+            ec);
+        if(!f || !fs.exists("inc/b.h") || sizeOf(fs, "inc/b.h") != 0) {
+            return 1;
+        }
+
+        // So does every write.
+        inr::vfsstream os(std::move(f), 0);
+        os << "int b;";
+        if(sizeOf(fs, "inc/b.h") != 6) {
+            inr::err() << "Write didn't invalidate the size\n";
+            return 1;
+        }
+    }
+
+    if(fs.rm("inc/b.h") || fs.exists("inc/b.h")) return 1;
+
+    // Made directories replace their negative entries, parents included.
+    if(fs.exists("x/y") || fs.exists("x") || fs.mkdir("x/y") ||
+       !fs.exists("x/y") || !fs.exists("x")) {
+        inr::err() << "mkdir didn't invalidate\n";
+        return 1;
+    }
+
+    // Changes around the cache need an explicit invalidation.
+    if(mem.addFile("inc/c.h", "") || !fs.exists("inc/c.h") ||
+       mem.rm("inc/c.h") || !fs.exists("inc/c.h")) {
+        return 1;
+    }
+    fs.invalidate("inc/c.h");
+    if(fs.exists("inc/c.h")) return 1;
+
+    // A stat that raced an invalidation isn't cached.
+    mem.afterStat = [&] {
+        mem.addFile("inc/d.h", "");
+        fs.invalidate("inc/d.h");
+    };
+    if(fs.exists("inc/d.h") || !fs.exists("inc/d.h")) {
+        inr::err() << "A stale stat was cached\n";
+        return 1;
+    }
+
+    std::size_t before = mem.stats;
+    fs.clear();
+    fs.exists("inc/a.h");
+    if(mem.stats != before + 1) return 1;
+
+    inr::sstream ss;
+    fs.dumpStats(ss);
+    if(ss.access().find("stat cache: ") != 0) return 1;
+    inr::out() << ss.access();
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/ConcurrentHMap.h>
+#include <inr/Support/Stream.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+int singleThreadTest() {
+    inr::ConcurrentHMap<int, std::unique_ptr<int>> map;
+
+    if(map.find(1) || !map.empty()) return 1;
+
+    auto [v, e] = map.try_emplace(1, std::make_unique<int>(42));
+    if(!e || **v != 42) return 1;
+
+    auto [v2, e2] = map.try_emplace(1, std::make_unique<int>(0));
+    if(e2 || v2 != v) return 1;
+
+    for(int i = 0; i < 0x10000; i++) {
+        map.try_emplace(i, std::make_unique<int>(i));
+    }
+
+    // Values don't move while the map grows.
+    if(map.find(1) != v || map.size() != 0x10000) {
+        inr::err() << "Value moved or size is wrong\n";
+        return 1;
+    }
+    for(int i = 2; i < 0x10000; i++) {
+        auto f = map.find(i);
+        if(!f || **f != i) {
+            inr::err() << "Index should be present: " << i << '\n';
+            return 1;
+        }
+    }
+
+    map.clear();
+    if(!map.empty() || map.find(1)) return 1;
+
+    return 0;
+}
+
+int multiThreadTest() {
+    constexpr unsigned threadCount = 8;
+    constexpr unsigned keyCount = 0x4000;
+
+    inr::ConcurrentHMap<std::string, unsigned, inr::HMapInfo<std::string_view>>
+        map;
+    std::vector<std::string> keys;
+    for(unsigned i = 0; i < keyCount; i++) keys.push_back(std::to_string(i));
+
+    // Every thread interns every key, in a different order, and remembers the
+    // address it got back.
+    std::vector<std::vector<const unsigned*>> seen(threadCount);
+    std::atomic<unsigned> inserted = 0;
+    std::atomic<bool> torn = false;
+    std::vector<std::thread> threads;
+
+    for(unsigned t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t] {
+            seen[t].resize(keyCount);
+            for(unsigned n = 0; n < keyCount; n++) {
+                unsigned i = (n * 7919 + t * 104729) % keyCount;
+                auto [v, e] = map.try_emplace(keys[i], i);
+                if(e) inserted++;
+                seen[t][i] = v;
+
+                // Lookups race with the other threads' insertions, a found
+                // value must already be fully constructed.
+                unsigned next = (i + 1) % keyCount;
+                if(auto f = map.find(std::string_view(keys[next]))) {
+                    if(*f != next) torn = true;
+                }
+            }
+        });
+    }
+    for(auto& thread : threads) thread.join();
+
+    if(torn) {
+        inr::err() << "Lookup saw a value before it was constructed\n";
+        return 1;
+    }
+    if(inserted != keyCount || map.size() != keyCount) {
+        inr::err() << "Every key should be inserted exactly once\n";
+        return 1;
+    }
+
+    for(unsigned i = 0; i < keyCount; i++) {
+        const unsigned* v = map.find(keys[i]);
+        if(!v || *v != i) {
+            inr::err() << "Key should be present: " << i << '\n';
+            return 1;
+        }
+        for(unsigned t = 0; t < threadCount; t++) {
+            if(seen[t][i] != v) {
+                inr::err() << "Threads got different values for: " << i
+                           << '\n';
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int main() {
+    if(int res = singleThreadTest()) return res;
+    if(int res = multiThreadTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/ConstDef.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/UnDef.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Support/Stream.h>
+
+int smallConstTest(inr::TUnit& unit, inr::TypeMap& tm) {
+    auto zero = unit.createConst(tm.getI32(), inr::bigint(32, 0));
+
+    if(zero != unit.createConst(tm.getI32(), inr::bigint(32, 0)) ||
+       zero != unit.createConst(tm.getI32(), 0)) {
+        inr::err() << "Same constant was created twice\n";
+        return 1;
+    }
+
+    if(zero == unit.createConst(tm.getI64(), 0) ||
+       zero == unit.createConst(tm.getI32(), 1)) {
+        inr::err() << "Different constants were merged\n";
+        return 1;
+    }
+
+    // Values are truncated to the type.
+    if(unit.createConst(tm.getI8(), 0x1FF) !=
+       unit.createConst(tm.getI8(), inr::bigint(8, 0xFF))) {
+        inr::err() << "Limb constant was not truncated\n";
+        return 1;
+    }
+
+    for(unsigned i = 0; i < 0x4000; i++) {
+        auto c = unit.createConst(tm.getI64(), i);
+        if(c->getInteger() != i || c != unit.createConst(tm.getI64(), i)) {
+            inr::err() << "Wrong constant for value: " << i << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int wideConstTest(inr::TUnit& unit, inr::TypeMap& tm) {
+    inr::bigint big(256, 42);
+    big.setBit(200);
+
+    auto c = unit.createConst(tm.getInt(256), big);
+    if(c != unit.createConst(tm.getInt(256), inr::bigint(big))) {
+        inr::err() << "Wide constant was created twice\n";
+        return 1;
+    }
+
+    if(c == unit.createConst(tm.getInt(256), 42) ||
+       unit.createConst(tm.getInt(256), 42) !=
+           unit.createConst(tm.getInt(256), inr::bigint(256, 42))) {
+        inr::err() << "Wide constants were not compared by every limb\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int undefTest(inr::TUnit& unit, inr::TypeMap& tm) {
+    if(unit.createUndef(tm.getI32()) != unit.createUndef(tm.getI32()) ||
+       unit.createUndef(tm.getI32()) == unit.createUndef(tm.getPtr())) {
+        inr::err() << "Undefs are not uniqued per type\n";
+        return 1;
+    }
+    return 0;
+}
+
+int main() {
+    inr::TUnit unit("ConstPoolTest.cpp");
+    inr::TypeMap tm;
+
+    if(int res = smallConstTest(unit, tm)) return res;
+    if(int res = wideConstTest(unit, tm)) return res;
+    if(int res = undefTest(unit, tm)) return res;
+
+    return 0;
+}
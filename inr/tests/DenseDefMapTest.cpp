@@ -0,0 +1,104 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/DenseDefMap.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/Stream.h>
+
+#include <vector>
+
+int numberingTest(inr::TUnit& unit, inr::TypeMap& tm) {
+    auto fn = unit.createFunction(
+        tm.getFunc(tm.getI32(), {tm.getI32(), tm.getI32()}, false), "fn",
+        inr::Linkage::Global, inr::TypeExt::NoExt);
+    auto entry = unit.createBlock(tm, fn, "entry");
+
+    std::vector<inr::InstDef*> insts;
+    inr::Def* acc = fn->getArg(0);
+    for(unsigned i = 0; i < 0x100; i++) {
+        acc = inr::AddInst::createAdd(entry, acc, fn->getArg(1));
+        insts.push_back((inr::InstDef*)acc);
+    }
+    inr::RetInst::createRet(tm, entry, acc);
+
+    // Args first, then the block and its instructions.
+    if(fn->getArg(1)->getSlot() != 1 || entry->getSlot() != 2 ||
+       insts[0]->getSlot() != 3 || fn->getNumSlots() != 0x100 + 4) {
+        inr::err() << "Defs were not numbered densely\n";
+        return 1;
+    }
+
+    inr::DenseDefMap<unsigned> map(*fn);
+    for(unsigned i = 0; i < insts.size(); i++) {
+        if(!map.try_emplace(insts[i], i).second) return 1;
+    }
+
+    if(map.size() != insts.size() || *map.find(insts[42]) != 42 ||
+       map.find(fn->getArg(0)) || map.try_emplace(insts[7], 0).second) {
+        inr::err() << "DenseDefMap lookups failed\n";
+        return 1;
+    }
+
+    if(!map.erase(insts[7]) || map.find(insts[7]) || map.erase(insts[7])) {
+        inr::err() << "DenseDefMap erase failed\n";
+        return 1;
+    }
+
+    // Defs created after the map was sized.
+    auto late = inr::AddInst::createAdd(entry, acc, acc);
+    if(!map.try_emplace(late, 1000).second || *map.find(late) != 1000) {
+        inr::err() << "DenseDefMap didn't grow for a new def\n";
+        return 1;
+    }
+
+    // Remove every other instruction, renumbering closes the holes.
+    for(unsigned i = 0; i < insts.size(); i += 2) {
+        entry->getInstructions().erase(insts[i]);
+    }
+    fn->renumber();
+
+    if(fn->getNumSlots() != 0x80 + 5 || insts[1]->getSlot() != 3 ||
+       late->getSlot() != fn->getNumSlots() - 1) {
+        inr::err() << "Renumbering didn't make the slots dense\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int unitLevelTest(inr::TUnit& unit, inr::TypeMap& tm) {
+    inr::DenseDefMap<unsigned> map(unit);
+
+    auto c0 = unit.createConst(tm.getI32(), 0);
+    auto c1 = unit.createConst(tm.getI32(), 1);
+    auto un = unit.createUndef(tm.getI32());
+
+    if(c0->getSlot() == c1->getSlot() || c1->getSlot() == un->getSlot() ||
+       c0->getSlot() >= unit.getNumSlots()) {
+        inr::err() << "Unit level defs were not numbered\n";
+        return 1;
+    }
+
+    map.try_emplace(c0, 0);
+    map.try_emplace(un, 2);
+    if(*map.find(c0) != 0 || map.find(c1) || *map.find(un) != 2) {
+        inr::err() << "Unit level DenseDefMap failed\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    inr::TUnit unit("DenseDefMapTest.cpp");
+    inr::TypeMap tm;
+
+    if(int res = numberingTest(unit, tm)) return res;
+    if(int res = unitLevelTest(unit, tm)) return res;
+
+    return 0;
+}
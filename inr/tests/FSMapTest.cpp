@@ -0,0 +1,137 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+static bool writeFile(std::string_view path, std::string_view contents) {
+    std::error_code ec;
+    auto f = inr::vfs::getNativeFs().open(
+        path, inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec);
+    return f && f->write(contents.data(), contents.size()) == contents.size();
+}
+
+/// @brief Maps `path`, checking it has `contents`.
+static bool check(std::string_view path, std::string_view contents,
+                  inr::vfs::Advice advice, bool mapped) {
+    std::error_code ec;
+    auto m = inr::vfs::getNativeFs().map(path, advice, ec);
+    if(!m) {
+        inr::err() << "Failed to map '" << path << "': " << ec.message()
+                   << '\n';
+        return false;
+    }
+    if(m->str() != contents || m->size() != contents.size()) {
+        inr::err() << "Mapped contents of '" << path << "' differ\n";
+        return false;
+    }
+    if(m->isMapped() != mapped) {
+        inr::err() << '\'' << path << "' should"
+                   << (mapped ? "" : "n't") << " be mapped\n";
+        return false;
+    }
+    return true;
+}
+
+/// @brief Forwards to the native fs, but uses the default `map`.
+class ReadOnlyFs : public inr::vfs::Filesystem {
+    inr::vfs::Filesystem& fs_ = inr::vfs::getNativeFs();
+
+public:
+    std::unique_ptr<inr::vfs::File> open(std::string_view path,
+                                         inr::vfs::OpenMode om,
+                                         std::error_code& ec) override {
+        return fs_.open(path, om, ec);
+    }
+
+    std::error_code rm(std::string_view path) override {
+        return fs_.rm(path);
+    }
+
+    std::error_code mkdir(std::string_view path) override {
+        return fs_.mkdir(path);
+    }
+
+    std::vector<std::string> listDirs(std::string_view path,
+                                      std::error_code& ec) override {
+        return fs_.listDirs(path, ec);
+    }
+
+    inr::vfs::FSStat stat(std::string_view path,
+                          std::error_code& ec) override {
+        return fs_.stat(path, ec);
+    }
+};
+
+int main() {
+    inr::vfs::Filesystem& fs = inr::vfs::getNativeFs();
+
+    std::string big;
+    for(std::size_t i = 0; big.size() < 100000; i++) {
+        big += std::to_string(i * 2654435761u) + '\n';
+    }
+    if(!writeFile("map_big.txt", big) || !writeFile("map_small.txt", "42") ||
+       !writeFile("map_empty.txt", "")) {
+        inr::err() << "Failed to write the test files\n";
+        return 1;
+    }
+
+    // Large files are mapped, small ones are read.
+    for(auto advice : {inr::vfs::Advice::Normal, inr::vfs::Advice::Sequential,
+                       inr::vfs::Advice::Random}) {
+        if(!check("map_big.txt", big, advice, true)) return 1;
+    }
+    if(!check("map_small.txt", "42", inr::vfs::Advice::Normal, false) ||
+       !check("map_empty.txt", "", inr::vfs::Advice::Normal, false)) {
+        return 1;
+    }
+
+    // Advice can change while the file is mapped.
+    std::error_code ec;
+    auto m = fs.map("map_big.txt", inr::vfs::Advice::Sequential, ec);
+    if(!m) return 1;
+    m->advise(inr::vfs::Advice::Random);
+    if(m->str().substr(big.size() - 10) != big.substr(big.size() - 10)) {
+        return 1;
+    }
+
+    // Devices have no size, they're read until the end.
+    if(!check("/dev/null", "", inr::vfs::Advice::Normal, false)) return 1;
+
+    if(fs.map("map_missing.txt", inr::vfs::Advice::Normal, ec) ||
+       ec != std::errc::no_such_file_or_directory) {
+        inr::err() << "Mapping a missing file should fail\n";
+        return 1;
+    }
+    ec.clear();
+    if(fs.map(".", inr::vfs::Advice::Normal, ec) ||
+       ec != std::errc::is_a_directory) {
+        inr::err() << "Mapping a directory should fail\n";
+        return 1;
+    }
+
+    // The fallback reads everything into a buffer.
+    ReadOnlyFs readFs;
+    ec.clear();
+    auto r = readFs.map("map_big.txt", inr::vfs::Advice::Sequential, ec);
+    if(!r || r->isMapped() || r->str() != big) {
+        inr::err() << "Fallback read differs\n";
+        return 1;
+    }
+    if(readFs.map(".", inr::vfs::Advice::Normal, ec) ||
+       ec != std::errc::is_a_directory) {
+        return 1;
+    }
+
+    fs.rm("map_big.txt");
+    fs.rm("map_small.txt");
+    fs.rm("map_empty.txt");
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/CachingFs.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/OverlayFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+static constexpr std::string_view PATH = "output_test.txt";
+
+static std::string contents(inr::vfs::Filesystem& fs, std::string_view path) {
+    std::error_code ec;
+    auto mapped = fs.map(path, inr::vfs::Advice::Normal, ec);
+    return mapped ? std::string(mapped->str()) : std::string("<missing>");
+}
+
+static bool write(inr::vfs::Filesystem& fs, std::string_view path,
+                  std::string_view str) {
+    std::error_code ec;
+    auto f = fs.open(path, inr::vfs::OpenMode(inr::vfs::OWRITE |
+                                              inr::vfs::OTRUNC),
+                     ec);
+    return f && f->write(str.data(), str.size()) == str.size();
+}
+
+static int outputTest(inr::vfs::Filesystem& fs, std::string_view name) {
+    if(!write(fs, PATH, "old")) {
+        inr::err() << name << ": failed to write the old file\n";
+        return 1;
+    }
+
+    std::error_code ec;
+    std::string tempPath;
+    {
+        // More space than it needs, the file still ends where it's written.
+        auto out = fs.createOutput(PATH, 4096, ec);
+        if(!out) {
+            inr::err() << name << ": createOutput failed: " << ec.message()
+                       << '\n';
+            return 1;
+        }
+        tempPath = out->getTempPath();
+
+        inr::vfsstream os(std::move(out), 4);
+        os << "new " << "contents";
+        os.flush();
+        if(contents(fs, PATH) != "old" || !fs.exists(tempPath)) {
+            inr::err() << name << ": output is visible before the commit\n";
+            return 1;
+        }
+    }
+    // Dropped without a commit.
+    if(contents(fs, PATH) != "old" || fs.exists(tempPath)) {
+        inr::err() << name << ": destroying the output didn't abort it\n";
+        return 1;
+    }
+
+    auto out = fs.createOutput(PATH, 4096, ec);
+    if(!out || out->write("new contents", 12) != 12 || out->sync()) {
+        inr::err() << name << ": failed to write the output\n";
+        return 1;
+    }
+    tempPath = out->getTempPath();
+    if((ec = out->commit())) {
+        inr::err() << name << ": commit failed: " << ec.message() << '\n';
+        return 1;
+    }
+    if(contents(fs, PATH) != "new contents" || fs.exists(tempPath) ||
+       out->isOpen() || out->write("x", 1) != 0 || !out->commit()) {
+        inr::err() << name << ": commit didn't replace the file\n";
+        return 1;
+    }
+
+    out = fs.createOutput(PATH, 0, ec);
+    if(!out) return 1;
+    tempPath = out->getTempPath();
+    out->write("partial", 7);
+    out->abort();
+    if(contents(fs, PATH) != "new contents" || fs.exists(tempPath)) {
+        inr::err() << name << ": abort left something behind\n";
+        return 1;
+    }
+
+    // The sibling can't be made if the directory isn't there.
+    if(fs.createOutput("output_test_missing/out.txt", 0, ec) || !ec) {
+        inr::err() << name << ": created an output in a missing directory\n";
+        return 1;
+    }
+
+    fs.rm(PATH);
+    return 0;
+}
+
+/// @brief The replaced file's permissions carry over to the new one.
+static int permsTest(inr::vfs::Filesystem& fs) {
+    if(!write(fs, PATH, "old")) return 1;
+
+    std::error_code ec;
+    std::filesystem::permissions(PATH, std::filesystem::perms::owner_read,
+                                 ec);
+    // Stat'd before, a cache has to forget it on the commit.
+    if(fs.stat(PATH, ec).getSize() != 3) return 1;
+    auto out = fs.createOutput(PATH, 0, ec);
+    if(!out || out->write("new contents", 12) != 12 || out->commit()) {
+        inr::err() << "Failed to replace a read-only file\n";
+        return 1;
+    }
+
+    inr::vfs::FSStat st = fs.stat(PATH, ec);
+    fs.rm(PATH);
+    if(st.getPerms() != inr::vfs::Perms::UserRead) {
+        inr::err() << "The new file didn't keep the old permissions\n";
+        return 1;
+    }
+    if(st.getSize() != 12) {
+        inr::err() << "The replaced file's stat is stale\n";
+        return 1;
+    }
+    return 0;
+}
+
+/// @brief Renames by copying, and can't remove anything.
+class StuckFs : public inr::vfs::MemoryFilesystem {
+public:
+    std::error_code rm(std::string_view) override {
+        return std::make_error_code(std::errc::permission_denied);
+    }
+
+    std::error_code rename(std::string_view from,
+                           std::string_view to) override {
+        return Filesystem::rename(from, to);
+    }
+};
+
+/// @brief A published file commits, even if the temporary can't be removed.
+static int publishedTest() {
+    StuckFs fs;
+    if(!write(fs, PATH, "old")) return 1;
+
+    std::error_code ec;
+    auto out = fs.createOutput(PATH, 0, ec);
+    if(!out || out->write("new", 3) != 3 || (ec = out->commit()) ||
+       contents(fs, PATH) != "new") {
+        inr::err() << "A published file failed to commit: " << ec.message()
+                   << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+static int renameTest() {
+    inr::vfs::MemoryFilesystem mfs;
+    mfs.addFile("dir/a", "a");
+    mfs.addFile("dir/b", "b");
+    mfs.mkdir("other");
+
+    std::error_code ec;
+    if(mfs.rename("dir/a", "dir/b") || contents(mfs, "dir/b") != "a" ||
+       mfs.exists("dir/a") || mfs.listDirs("dir", ec).size() != 1) {
+        inr::err() << "Renaming over a file is wrong\n";
+        return 1;
+    }
+    if(mfs.rename("dir/b", "other/c") || contents(mfs, "other/c") != "a" ||
+       mfs.listDirs("other", ec).size() != 1 ||
+       !mfs.listDirs("dir", ec).empty()) {
+        inr::err() << "Renaming into a directory is wrong\n";
+        return 1;
+    }
+    if(mfs.rename("other/c", "other") != std::errc::is_a_directory ||
+       mfs.rename("dir", "moved") != std::errc::is_a_directory ||
+       mfs.rename("missing", "x") != std::errc::no_such_file_or_directory ||
+       mfs.rename("other/c", "nope/c") !=
+           std::errc::no_such_file_or_directory) {
+        inr::err() << "Bad renames aren't refused\n";
+        return 1;
+    }
+
+    // The overlay only renames files in its top layer.
+    inr::vfs::MemoryFilesystem lower;
+    lower.addFile("base.txt", "base");
+    inr::vfs::OverlayFilesystem ofs(lower);
+    ofs.pushOverlay(mfs);
+    if(ofs.rename("base.txt", "x") != std::errc::read_only_file_system ||
+       ofs.rename("other/c", "base.txt") || contents(ofs, "base.txt") != "a" ||
+       contents(lower, "base.txt") != "base") {
+        inr::err() << "Overlay rename is wrong\n";
+        return 1;
+    }
+    return 0;
+}
+
+int main() {
+    if(int res = outputTest(inr::vfs::getNativeFs(), "native")) return res;
+
+    inr::vfs::MemoryFilesystem mfs;
+    if(int res = outputTest(mfs, "memory")) return res;
+
+    // The default goes through `open` and `rename` of the overlay.
+    inr::vfs::MemoryFilesystem lower;
+    lower.addFile(PATH, "lower");
+    inr::vfs::OverlayFilesystem ofs(lower);
+    ofs.pushOverlay(mfs);
+    if(int res = outputTest(ofs, "overlay")) return res;
+    if(contents(lower, PATH) != "lower") return 1;
+
+    if(int res = permsTest(inr::vfs::getNativeFs())) return res;
+
+    // The cache forwards to the native output, and forgets what it replaced.
+    inr::vfs::CachingFilesystem cfs(inr::vfs::getNativeFs());
+    if(int res = outputTest(cfs, "caching")) return res;
+    if(int res = permsTest(cfs)) return res;
+    if(int res = publishedTest()) return res;
+    if(int res = renameTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <string>
+#include <string_view>
+#include <system_error>
+
+static int fileTest(inr::vfs::Filesystem& fs) {
+    std::error_code ec;
+    auto f = fs.open("vector_io.bin",
+                     inr::vfs::OpenMode(inr::vfs::OREAD | inr::vfs::OWRITE |
+                                        inr::vfs::OTRUNC),
+                     ec);
+    if(!f) {
+        inr::err() << "Failed to open: " << ec.message() << '\n';
+        return 1;
+    }
+
+    // A header, a section and a string table in one go.
+    inr::vfs::ConstIOVec out[] = {{"HDR:", 4}, {"section", 7}, {"", 0},
+                                  {"\0strtab", 7}};
+    if(f->writev(out) != 18 || f->tell() != 18) {
+        inr::err() << "writev wrote the wrong amount\n";
+        return 1;
+    }
+
+    // Positional calls leave the offset alone.
+    char buf[8] = {};
+    if(f->pwrite("SEC", 3, 4) != 3 || f->tell() != 18 ||
+       f->pread(buf, 7, 4) != 7 || std::string_view(buf, 7) != "SECtion" ||
+       f->tell() != 18) {
+        inr::err() << "pread/pwrite are wrong\n";
+        return 1;
+    }
+    if(f->pread(buf, 8, 16) != 2 || f->pread(buf, 8, 100) != 0) {
+        inr::err() << "pread past the end is wrong\n";
+        return 1;
+    }
+
+    char hdr[4], sec[7], tab[8];
+    inr::vfs::IOVec in[] = {{hdr, 4}, {sec, 7}, {tab, 8}};
+    if(!f->seek(0, inr::vfs::SSET) || f->readv(in) != 18 ||
+       std::string_view(hdr, 4) != "HDR:" ||
+       std::string_view(sec, 7) != "SECtion" ||
+       std::string_view(tab, 7) != std::string_view("\0strtab", 7)) {
+        inr::err() << "readv read the wrong bytes\n";
+        return 1;
+    }
+
+    f.reset();
+    fs.rm("vector_io.bin");
+    return 0;
+}
+
+int main() {
+    if(int res = fileTest(inr::vfs::getNativeFs())) return res;
+
+    // Memory files use the default seek and read/write versions.
+    inr::vfs::MemoryFilesystem mem;
+    if(int res = fileTest(mem)) return res;
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include "Vfs/POSIX/Walk.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+static bool makeTree(inr::vfs::Filesystem& fs) {
+    for(std::string_view dir :
+        {"walk_root", "walk_root/a", "walk_root/a/deep", "walk_root/b"}) {
+        if(fs.mkdir(dir)) return false;
+    }
+    for(std::string_view file : {"walk_root/x.txt", "walk_root/a/y.txt",
+                                 "walk_root/a/deep/z.txt", "walk_root/b/w"}) {
+        std::error_code ec;
+        if(!fs.open(file, inr::vfs::OpenMode(inr::vfs::OWRITE |
+                                             inr::vfs::OTRUNC),
+                    ec)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int walkTest(inr::vfs::Filesystem& fs) {
+    if(!makeTree(fs)) {
+        inr::err() << "Failed to make the tree\n";
+        return 1;
+    }
+
+    std::vector<std::string> seen;
+    auto ec = fs.walk("walk_root", [&](const inr::vfs::DirEntry& e) {
+        bool dir = e.getFT() == inr::vfs::FileType::Directory;
+        if(e.getFT() == inr::vfs::FileType::None ||
+           !e.getPath().ends_with(e.getName()) ||
+           std::count(e.getPath().begin(), e.getPath().end(), '/') !=
+               long(e.getDepth() + 1)) {
+            seen.emplace_back("bad entry");
+        }
+        seen.emplace_back(std::string(e.getPath()) + (dir ? "/" : ""));
+        return inr::vfs::WalkAction::Continue;
+    });
+
+    // Directories come before their entries.
+    auto pos = [&](std::string_view path) {
+        return std::find(seen.begin(), seen.end(), path) - seen.begin();
+    };
+    if(ec || seen.size() != 7 ||
+       pos("walk_root/a/") > pos("walk_root/a/y.txt") ||
+       pos("walk_root/a/deep/") > pos("walk_root/a/deep/z.txt") ||
+       pos("walk_root/b/w") == 7 || pos("walk_root/x.txt") == 7) {
+        inr::err() << "Walk saw the wrong entries:\n";
+        for(auto& path : seen) inr::err() << "  " << path << '\n';
+        return 1;
+    }
+
+    // Skipped directories aren't entered.
+    seen.clear();
+    ec = fs.walk("walk_root", [&](const inr::vfs::DirEntry& e) {
+        seen.emplace_back(e.getName());
+        return e.getName() == "a" ? inr::vfs::WalkAction::Skip
+                                  : inr::vfs::WalkAction::Continue;
+    });
+    if(ec || seen.size() != 4 || pos("y.txt") != 4) {
+        inr::err() << "Walk entered a skipped directory\n";
+        return 1;
+    }
+
+    // Stopping ends it right away.
+    unsigned visits = 0;
+    ec = fs.walk("walk_root", [&](const inr::vfs::DirEntry&) {
+        visits++;
+        return inr::vfs::WalkAction::Stop;
+    });
+    if(ec || visits != 1) return 1;
+
+    auto none = [](const inr::vfs::DirEntry&) {
+        return inr::vfs::WalkAction::Continue;
+    };
+    if(fs.walk("walk_missing", none) != std::errc::no_such_file_or_directory ||
+       fs.walk("walk_root/x.txt", none) != std::errc::not_a_directory) {
+        inr::err() << "Walking a bad path should fail\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+/// @brief Forwards to the native fs, but its walk stats every entry instead
+/// of trusting d_type.
+class UntypedFs : public inr::vfs::Filesystem {
+    inr::vfs::Filesystem& fs_ = inr::vfs::getNativeFs();
+
+public:
+    std::unique_ptr<inr::vfs::File> open(std::string_view path,
+                                         inr::vfs::OpenMode om,
+                                         std::error_code& ec) override {
+        return fs_.open(path, om, ec);
+    }
+
+    std::error_code rm(std::string_view path) override {
+        return fs_.rm(path);
+    }
+
+    std::error_code mkdir(std::string_view path) override {
+        return fs_.mkdir(path);
+    }
+
+    std::vector<std::string> listDirs(std::string_view path,
+                                      std::error_code& ec) override {
+        return fs_.listDirs(path, ec);
+    }
+
+    inr::vfs::FSStat stat(std::string_view path,
+                          std::error_code& ec) override {
+        return fs_.stat(path, ec);
+    }
+
+    std::error_code walk(std::string_view path,
+                         inr::vfs::DirVisitor& visitor) override {
+        return inr::vfs::walkUntyped(path, visitor);
+    }
+    using Filesystem::walk;
+};
+
+/// @brief Walks a tree made on the native fs, and removes it after.
+static int nativeTest(inr::vfs::Filesystem& fs) {
+    int res = walkTest(fs);
+    std::error_code ec;
+    std::filesystem::remove_all("walk_root", ec);
+    if(ec) {
+        inr::err() << "Failed to remove the tree: " << ec.message() << '\n';
+        return 1;
+    }
+    return res;
+}
+
+int main() {
+    if(int res = nativeTest(inr::vfs::getNativeFs())) return res;
+
+    // The types come from fstatat instead of readdir.
+    UntypedFs untyped;
+    if(int res = nativeTest(untyped)) return res;
+
+    inr::vfs::MemoryFilesystem mem;
+    if(int res = walkTest(mem)) return res;
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+
+// Statistics are compiled out by default, this test turns them on for itself.
+#ifndef INERTIA_HMAP_STATS
+#define INERTIA_HMAP_STATS
+#endif
+
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HSet.h>
+#include <inr/Support/Stream.h>
+#include <inr/Support/StrStream.h>
+
+#include <cstddef>
+#include <string>
+
+/// @brief Puts every key on the same group.
+struct BadInfo {
+    static std::size_t hash(int) {
+        return 0;
+    }
+
+    static bool equal(int lhs, int rhs) {
+        return lhs == rhs;
+    }
+};
+
+int mapStatsTest() {
+    inr::HMap<int, int> map;
+
+    for(int i = 0; i < 1000; i++) map.try_emplace(i, i);
+    for(int i = 0; i < 100; i++) map.erase(i);
+    for(int i = 0; i < 1000; i++) map.find(i);
+
+    inr::HashStats stats = map.getStats();
+    if(stats.size != 900 || stats.capacity != map.capacity()) return 1;
+    if(stats.tombstones > 100) {
+        inr::err() << "Erasing left too many tombstones\n";
+        return 1;
+    }
+    if(!stats.rehashes || !stats.bytes) return 1;
+    if(stats.lookups < 2000 || stats.averageProbe() < 1 ||
+       stats.maxProbe < 1) {
+        inr::err() << "Lookups should be counted\n";
+        return 1;
+    }
+
+    inr::sstream ss;
+    map.dumpStats(ss);
+    if(ss.access().find("rehashes: ") == std::string::npos) {
+        inr::err() << "Dump is missing the rehash count\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+int badHashTest() {
+    inr::HSet<int> good;
+    inr::HSet<int, BadInfo> bad;
+
+    for(int i = 0; i < 500; i++) {
+        good.try_emplace(i);
+        bad.try_emplace(i);
+    }
+
+    if(bad.getStats().averageProbe() <= good.getStats().averageProbe() * 4) {
+        inr::err() << "A constant hash should show up as long probes\n";
+        return 1;
+    }
+
+    // Every key probes through the first group, which is full, so erasing from
+    // it has to leave tombstones.
+    for(int i = 0; i < 16; i++) bad.erase(i);
+    inr::HashStats stats = bad.getStats();
+    if(stats.tombstones == 0 || stats.tombstoneRatio() <= 0) {
+        inr::err() << "Erasing from a full group should leave tombstones\n";
+        return 1;
+    }
+    for(int i = 16; i < 500; i++) {
+        if(!bad.find(i)) {
+            inr::err() << "Key lost behind a tombstone: " << i << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main() {
+    if(int res = mapStatsTest()) return res;
+    if(int res = badHashTest()) return res;
+
+    return 0;
+}
@@ -2,10 +2,13 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/ADT/HMap.h>
+#include <inr/ADT/HashGroup.h>
 #include <inr/Support/Stream.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
+#include <utility>
 
 int integerMapTest() {
     inr::HMap<int, int> map;
@@ -81,9 +84,156 @@ int stringMapTest() {
     return 0;
 }
 
+int capacityTest() {
+    inr::HMap<int, int> map;
+    if(map.capacity() != 0) {
+        inr::err() << "Empty map shouldn't allocate\n";
+        return 1;
+    }
+    if(map.find(42) || map.erase(42)) return 1;
+
+    map.reserve(1000);
+    std::size_t reserved = map.capacity();
+    if(reserved < 1000) return 1;
+
+    for(int i = 0; i < 1000; i++) map.try_emplace(i, i);
+    if(map.capacity() != reserved) {
+        inr::err() << "Reserved map shouldn't grow\n";
+        return 1;
+    }
+
+    for(int i = 10; i < 1000; i++) map.erase(i);
+    map.shrink_to_fit();
+    if(map.capacity() >= reserved || map.size() != 10) {
+        inr::err() << "Map should shrink to fit its entries\n";
+        return 1;
+    }
+    for(int i = 0; i < 10; i++) {
+        auto v = map.find(i);
+        if(!v || *v != i) {
+            inr::err() << "Shrinking lost index: " << i << '\n';
+            return 1;
+        }
+    }
+
+    map.clear();
+    map.shrink_to_fit();
+    if(map.capacity() != 0) {
+        inr::err() << "Empty map should free on shrink\n";
+        return 1;
+    }
+
+    // A full map doesn't grow for a key it already has.
+    inr::HMap<int, int> full;
+    full.try_emplace(0, 0);
+    std::size_t cap = full.capacity();
+    for(int i = 1; full.size() < cap - cap / 8; i++) full.try_emplace(i, i);
+    if(full.capacity() != cap) return 1;
+    if(full.try_emplace(0, 1).second || full.capacity() != cap) {
+        inr::err() << "Finding an existing key grew the map\n";
+        return 1;
+    }
+
+    inr::HMap<int, int> hinted(100);
+    if(hinted.capacity() < 100) return 1;
+
+    inr::HMap<int, int> moved(std::move(hinted));
+    moved.try_emplace(1, 1);
+    if(hinted.capacity() != 0 || !moved.find(1)) return 1;
+
+    return 0;
+}
+
+int churnTest() {
+    inr::HMap<int, int> map;
+
+    // A sliding window of 100 live keys, the map shouldn't keep growing.
+    for(int i = 0; i < 100000; i++) {
+        map.try_emplace(i, i);
+        if(i >= 100 && !map.erase(i - 100)) {
+            inr::err() << "Index should be erased: " << i - 100 << '\n';
+            return 1;
+        }
+    }
+
+    if(map.size() != 100 || map.capacity() > 256) {
+        inr::err() << "Churn grew the map to: " << map.capacity() << '\n';
+        return 1;
+    }
+    for(int i = 100000 - 100; i < 100000; i++) {
+        auto v = map.find(i);
+        if(!v || *v != i) {
+            inr::err() << "Index should be present: " << i << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int groupTest() {
+    alignas(inr::HASH_GROUP_WIDTH) std::int8_t ctrl[inr::HASH_GROUP_WIDTH];
+    std::uint32_t seed = 42;
+
+    for(unsigned round = 0; round < 0x1000; round++) {
+        for(auto& c : ctrl) {
+            seed = seed * 1664525 + 1013904223;
+            unsigned pick = seed >> 24;
+            if(pick < 0x20) c = (std::int8_t)inr::Ctrl::Empty;
+            else if(pick < 0x30) c = (std::int8_t)inr::Ctrl::Deleted;
+            else c = std::int8_t(pick & 0x7F);
+        }
+
+        inr::ScalarGroup scalar(ctrl);
+        inr::HashGroup group(ctrl);
+        auto same = [](inr::GroupMask a, inr::GroupMask b) {
+            auto ai = a.begin(), bi = b.begin();
+            for(; ai != a.end() && bi != b.end(); ++ai, ++bi) {
+                if(*ai != *bi) return false;
+            }
+            return ai == a.end() && bi == b.end();
+        };
+
+        std::int8_t h2 = ctrl[round % inr::HASH_GROUP_WIDTH] & 0x7F;
+        if(!same(scalar.match(h2), group.match(h2)) ||
+           !same(scalar.matchEmpty(), group.matchEmpty()) ||
+           !same(scalar.matchFree(), group.matchFree())) {
+            inr::err() << "Group matches differ from scalar at round: "
+                       << round << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int pointerMapTest() {
+    // Identity hashed, 64 byte aligned keys shouldn't cluster.
+    struct alignas(64) Node {
+        int val;
+    };
+    static Node nodes[0x4000];
+    inr::HMap<const Node*, int> map;
+
+    for(int i = 0; i < 0x4000; i++) map.try_emplace(nodes + i, i);
+    for(int i = 0; i < 0x4000; i++) {
+        auto v = map.find(nodes + i);
+        if(!v || *v != i) {
+            inr::err() << "Pointer key should be present: " << i << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 int main() {
     if(int res = integerMapTest()) return res;
     if(int res = stringMapTest()) return res;
+    if(int res = capacityTest()) return res;
+    if(int res = churnTest()) return res;
+    if(int res = groupTest()) return res;
+    if(int res = pointerMapTest()) return res;
 
     return 0;
 }
@@ -5,6 +5,7 @@
 #include <inr/Support/Stream.h>
 
 #include <cstddef>
+#include <utility>
 
 int integerSetTest() {
     inr::HSet<int> set;
@@ -67,8 +68,67 @@ int integerSetTest() {
     return 0;
 }
 
+int capacityTest() {
+    inr::HSet<int> set;
+    if(set.capacity() != 0 || set.find(42)) return 1;
+
+    inr::HSet<int> hinted(500);
+    std::size_t reserved = hinted.capacity();
+    for(int i = 0; i < 500; i++) hinted.try_emplace(i);
+    if(hinted.capacity() != reserved) {
+        inr::err() << "Reserved set shouldn't grow\n";
+        return 1;
+    }
+
+    set = std::move(hinted);
+    for(int i = 0; i < 500; i++) set.erase(i);
+    set.shrink_to_fit();
+    if(set.capacity() != 0 || !set.empty()) {
+        inr::err() << "Empty set should free on shrink\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+/// @brief Counts how often keys are hashed.
+struct CountingInfo {
+    static inline unsigned hashes = 0;
+
+    static std::size_t hash(int key) {
+        hashes++;
+        return inr::HMapInfo<int>::hash(key);
+    }
+
+    static bool equal(int lhs, int rhs) {
+        return lhs == rhs;
+    }
+};
+
+int prehashedTest() {
+    inr::HSet<int, CountingInfo> set;
+    std::size_t h = inr::HMapInfo<int>::hash(7);
+
+    unsigned made = 0;
+    auto make = [&] {
+        made++;
+        return 7;
+    };
+    if(!set.try_emplace_hashed(7, h, make).second ||
+       set.try_emplace_hashed(7, h, make).second || made != 1) {
+        return 1;
+    }
+    if(CountingInfo::hashes) {
+        inr::err() << "A prehashed insert hashed the key again\n";
+        return 1;
+    }
+    return set.find(7) ? 0 : 1;
+}
+
 int main() {
     if(int res = integerSetTest()) return res;
+    if(int res = capacityTest()) return res;
+    if(int res = prehashedTest()) return res;
 
     return 0;
 }
@@ -2,9 +2,12 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/ADT/IList.h>
+#include <inr/Support/Allocator.h>
 #include <inr/Support/Stream.h>
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 struct int_node : public inr::ilist_node<int_node> {
     int val;
@@ -12,6 +15,69 @@ struct int_node : public inr::ilist_node<int_node> {
     int_node(int v) : val(v) {}
 };
 
+static int liveNodes = 0;
+
+struct counted_node : public inr::ilist_node<counted_node> {
+    int val;
+
+    counted_node(int v) : val(v) {
+        liveNodes++;
+    }
+
+    ~counted_node() {
+        liveNodes--;
+    }
+};
+
+static_assert(std::is_trivially_destructible_v<inr::ilist<int_node>>,
+              "Unowned lists must stay trivially destructible");
+
+static int policyTest() {
+    {
+        inr::ilist<counted_node, inr::ilist_heap_alloc> heap;
+        for(int i = 0; i < 0x20; i++) heap.emplace_back(i);
+        if(liveNodes != 0x20) return 1;
+
+        heap.clear();
+        if(liveNodes != 0 || !heap.empty()) return 1;
+
+        for(int i = 0; i < 0x10; i++) heap.emplace_back(i);
+    }
+    if(liveNodes != 0) return 1;
+
+    inr::BumpAllocator alloc;
+    {
+        inr::ilist<counted_node, inr::ilist_arena_alloc> arena(alloc);
+        for(int i = 0; i < 0x20; i++) arena.emplace_back(i);
+
+        int expected = 0;
+        for(const counted_node& n : arena) {
+            if(n.val != expected++) return 1;
+        }
+
+        // Moving keeps the policy, the moved to list releases the nodes.
+        inr::ilist<counted_node, inr::ilist_arena_alloc> moved(
+            std::move(arena));
+        if(!arena.empty() || liveNodes != 0x20) return 1;
+        moved.clear();
+        if(liveNodes != 0) return 1;
+
+        moved.emplace_back(1);
+    }
+    if(liveNodes != 0) return 1;
+
+    // Trivial nodes are never walked, the arena drops them.
+    {
+        inr::ilist<int_node, inr::ilist_arena_alloc> ints(alloc);
+        for(int i = 0; i < 0x100; i++) ints.push_back(ints.create(i));
+        ints.clear();
+        if(!ints.empty()) return 1;
+    }
+    alloc.reset();
+
+    return 0;
+}
+
 int main() {
     inr::ilist<int_node> ints;
 
@@ -33,5 +99,5 @@ int main() {
 
     ints.deleteNodes();
 
-    return 0;
+    return policyTest();
 }
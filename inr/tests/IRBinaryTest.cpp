@@ -0,0 +1,246 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/ArgDef.h>
+#include <inr/IR/BinaryReader.h>
+#include <inr/IR/BinaryWriter.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/Printer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/Verifier.h>
+#include <inr/Math/BigInt.h>
+#include <inr/Support/StrStream.h>
+#include <inr/Support/Stream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief Builds a unit using every instruction, with named and unnamed
+/// defs, wide constants, undefs and instructions used before they appear.
+static void buildUnit(inr::TUnit& unit, inr::TypeMap& tm) {
+    const inr::IntType* i32 = tm.getI32();
+
+    unit.createFunction(tm.getFunc(i32, {tm.getPtr()}, true), "printf",
+                        inr::Linkage::Global, inr::TypeExt::SignExt);
+
+    inr::FuncDef* fn = unit.createFunction(
+        tm.getFunc(i32, {i32, tm.getPtr(), tm.getInt(200)}, false), "loop",
+        inr::Linkage::Local, inr::TypeExt::ZeroExt);
+    fn->setCC(inr::CallingConv::SystemV);
+    fn->getArg(0)->setName("n");
+    fn->getArg(0)->setExt(inr::TypeExt::SignExt);
+    fn->getArg(1)->setName("p");
+
+    auto entry = unit.createBlock(tm, fn, "entry");
+    auto head = unit.createBlock(tm, fn, "head");
+    auto body = unit.createBlock(tm, fn, {});
+    auto exit = unit.createBlock(tm, fn, "exit");
+    auto dead = unit.createBlock(tm, fn, "dead");
+
+    auto slot = inr::AllocaInst::createAlloca(
+        tm, entry, tm.getInt(200), unit.createConst(i32, 4), "slot");
+    inr::StoreInst::createStore(tm, entry, slot, fn->getArg(2));
+    inr::JmpInst::createJmp(tm, entry, head);
+
+    auto iv = inr::PhiInst::createPhi(head, i32, "iv");
+    auto self = inr::PhiInst::createPhi(head, i32);
+    auto done = inr::CmpInst::createCmp(tm, head, inr::CmpInst::SGreaterEqual,
+                                        iv, fn->getArg(0), "done");
+    inr::JmpInst::createJmpCond(tm, head, done, exit, body);
+
+    inr::bigint wide = inr::bigint(200, 0x123456789ABCDEFULL);
+    wide.setBit(199);
+    wide.setBit(130);
+    auto big = inr::LoadInst::createLoad(body, tm.getInt(200), slot);
+    auto mixed = inr::XorInst::createXor(
+        body, big, unit.createConst(tm.getInt(200), wide), "mixed");
+    inr::StoreInst::createStore(tm, body, slot, mixed);
+
+    // Every binary instruction, alternating named and numbered results.
+    inr::Def* v = iv;
+    unsigned op = 0;
+    auto binary = [&](auto create) {
+        inr::Def* rhs = op % 3 ? (inr::Def*)unit.createConst(i32, op)
+                               : (inr::Def*)unit.createUndef(i32);
+        v = create(body, v, rhs, op % 2 ? "" : "op" + std::to_string(op));
+        op++;
+    };
+    binary(inr::AddInst::createAdd);
+    binary(inr::SubInst::createSub);
+    binary(inr::MulInst::createMul);
+    binary(inr::UDivInst::createUDiv);
+    binary(inr::SDivInst::createSDiv);
+    binary(inr::URemInst::createURem);
+    binary(inr::SRemInst::createSRem);
+    binary(inr::ShlInst::createShl);
+    binary(inr::LShrInst::createLShr);
+    binary(inr::AShrInst::createAShr);
+    binary(inr::AndInst::createAnd);
+    binary(inr::OrInst::createOr);
+    binary(inr::XorInst::createXor);
+    auto next = inr::AddInst::createAdd(body, iv, unit.createConst(i32, 1));
+    inr::JmpInst::createJmp(tm, body, head);
+
+    iv->addIncoming(unit.createConst(i32, 0), entry);
+    iv->addIncoming(next, body);
+    self->addIncoming(v, entry);
+    self->addIncoming(self, body);
+
+    inr::RetInst::createRet(tm, exit, self);
+    inr::UnreachableInst::createUnreachable(tm, dead);
+
+    auto vd = unit.createFunction(tm.getFunc(tm.getVoid(), {}, false), "nop",
+                                  inr::Linkage::Weak, inr::TypeExt::NoExt);
+    inr::RetInst::createRetVoid(tm, unit.createBlock(tm, vd, "entry"));
+}
+
+static std::string print(const inr::TUnit& unit) {
+    inr::sstream ss;
+    inr::IRPrinter(unit).print(ss);
+    return ss.str();
+}
+
+static int roundTripTest() {
+    inr::TUnit unit("IRBinaryTest.cpp");
+    inr::TypeMap tm;
+    buildUnit(unit, tm);
+    if(!inr::Verifier::verify(unit, &inr::err())) return 1;
+
+    std::vector<std::uint8_t> data;
+    inr::BinaryWriter::write(unit, data);
+
+    // A different type map, the types are rebuilt by the reader.
+    inr::TUnit copy("IRBinaryTest.cpp");
+    inr::TypeMap tm2;
+    if(!inr::BinaryReader::read(copy, tm2, data, &inr::err())) return 1;
+    if(!inr::Verifier::verify(copy, &inr::err())) return 1;
+
+    std::string expected = print(unit);
+    if(print(copy) != expected) {
+        inr::err() << "Read unit differs:\n" << print(copy) << '\n';
+        return 1;
+    }
+
+    // Uses are rebuilt too, not only the operands.
+    const inr::FuncDef& fn = *++copy.getFuncs().begin();
+    const inr::BlockDef& head = *++fn.getBlocks().begin();
+    const inr::InstDef& self = *++head.getInstructions().begin();
+    if(self.getNumUsers() != 2 || fn.getCC() != inr::CallingConv::SystemV)
+        return 1;
+
+    // Writing the copy gives the same bytes.
+    std::vector<std::uint8_t> again;
+    inr::BinaryWriter::write(copy, again);
+    if(again != data) return 1;
+
+    return 0;
+}
+
+static int corruptTest() {
+    inr::TUnit unit("IRBinaryTest.cpp");
+    inr::TypeMap tm;
+    buildUnit(unit, tm);
+    std::vector<std::uint8_t> data;
+    inr::BinaryWriter::write(unit, data);
+
+    // Every truncation is rejected, without reading past the end.
+    for(std::size_t size = 0; size < data.size(); size++) {
+        std::vector<std::uint8_t> cut(data.begin(), data.begin() + size);
+        inr::TUnit copy("cut");
+        if(inr::BinaryReader::read(copy, tm, cut)) {
+            inr::err() << "Truncated module was accepted, size: " << size
+                       << '\n';
+            return 1;
+        }
+    }
+
+    // Flipped bytes either fail or read something, but never crash.
+    for(std::size_t i = 0; i < data.size(); i++) {
+        for(std::uint8_t flip : {0x01, 0x80, 0xFF}) {
+            std::vector<std::uint8_t> bad = data;
+            bad[i] ^= flip;
+            inr::TUnit copy("bad");
+            inr::BinaryReader::read(copy, tm, bad);
+        }
+    }
+
+    inr::sstream ss;
+    std::vector<std::uint8_t> notIR = {'E', 'L', 'F', 0};
+    inr::TUnit copy("notIR");
+    if(inr::BinaryReader::read(copy, tm, notIR, &ss)) return 1;
+    if(ss.access().find("not a binary IR module") == std::string::npos) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static int lazyTest() {
+    inr::TUnit unit("IRBinaryTest.cpp");
+    inr::TypeMap tm;
+    buildUnit(unit, tm);
+    std::vector<std::uint8_t> data;
+    inr::BinaryWriter::write(unit, data);
+    std::string expected = print(unit);
+
+    inr::TUnit copy("IRBinaryTest.cpp");
+    {
+        inr::BinaryReader reader(copy, tm, data, &inr::err());
+        if(!reader.open()) return 1;
+
+        // Only the definitions are lazy, and nothing is read yet.
+        inr::FuncDef& decl = *copy.getFuncs().begin();
+        inr::FuncDef& fn = *++copy.getFuncs().begin();
+        if(decl.isMaterializable() || !fn.isMaterializable()) return 1;
+        const inr::ConstDef* one = copy.createConst(tm.getI32(), 1);
+        if(one->getNumUsers() != 0) return 1;
+
+        // The first access reads the body.
+        if(fn.getBlocks().empty() || fn.isMaterializable()) return 1;
+        unsigned users = one->getNumUsers();
+        if(users == 0) return 1;
+
+        // Releasing it drops its uses, and it can be read again.
+        reader.release(fn);
+        if(!fn.isMaterializable() || one->getNumUsers() != 0) return 1;
+        if(!fn.materialize() || one->getNumUsers() != users) return 1;
+
+        if(print(copy) != expected) {
+            inr::err() << "Lazily read unit differs:\n" << print(copy) << '\n';
+            return 1;
+        }
+    }
+    if(copy.getMaterializer()) return 1;
+
+    // Bodies that weren't read when the reader goes away stay empty.
+    inr::TUnit other("IRBinaryTest.cpp");
+    {
+        inr::BinaryReader reader(other, tm, data);
+        if(!reader.open()) return 1;
+    }
+    for(const inr::FuncDef& fn : other.getFuncs()) {
+        if(fn.isMaterializable() || !fn.getBlocks().empty()) return 1;
+    }
+
+    // A bad body is only noticed once it is read.
+    std::vector<std::uint8_t> bad = data;
+    bad[bad.size() - 3] = 0xFF;
+    inr::TUnit broken("IRBinaryTest.cpp");
+    inr::BinaryReader reader(broken, tm, bad);
+    if(!reader.open() || reader.materializeAll()) return 1;
+
+    return 0;
+}
+
+int main() {
+    if(int res = roundTripTest()) return res;
+    if(int res = corruptTest()) return res;
+    if(int res = lazyTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/Parser.h>
+#include <inr/IR/Printer.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/Verifier.h>
+#include <inr/Support/StrStream.h>
+#include <inr/Support/Stream.h>
+
+#include <string>
+#include <string_view>
+
+/// @brief Every instruction, in the exact format of the printer.
+static constexpr std::string_view SOURCE = R"(module.name = IRParseTest.cpp
+
+def fn signext i32 @printf(ptr %0, ...)
+
+def fn zeroext i32 local @loop(i32 signext %n, ptr %p, i200 %1) {
+entry:
+    %slot = alloca(i200, i32 4)
+    store %slot, i200 %1
+    jmp block %head
+head:
+    %iv = i32 phi([0, %entry], [%2, %3])
+    %4 = i32 phi([%op12, %entry], [%4, %3])
+    %done = i32 cmp.sge(%iv, %n)
+    jmp i1 %done, block %exit, block %3
+3:
+    %5 = i200 load(%slot)
+    %mixed = i200 xor(%5, -1234567890123456789012345678901234567)
+    store %slot, i200 %mixed
+    %op0 = i32 add(%iv, undef)
+    %6 = i32 sub(%op0, 1)
+    %op2 = i32 mul(%6, 2)
+    %7 = i32 udiv(%op2, undef)
+    %op4 = i32 sdiv(%7, 4)
+    %8 = i32 urem(%op4, 5)
+    %op6 = i32 srem(%8, undef)
+    %9 = i32 shl(%op6, 7)
+    %op8 = i32 lshr(%9, 8)
+    %10 = i32 ashr(%op8, undef)
+    %op10 = i32 and(%10, -10)
+    %11 = i32 or(%op10, 11)
+    %op12 = i32 xor(%11, undef)
+    %2 = i32 add(%iv, 1)
+    %12 = i1 cmp.neq(%done, -1)
+    %13 = i64 cmp.ul(-9223372036854775808, -1)
+    jmp block %head
+exit:
+    ret i32 %4
+dead:
+    unreachable
+}
+
+def fn void weak @nop() {
+entry:
+    ret void
+}
+
+)";
+
+static std::string print(const inr::TUnit& unit) {
+    inr::sstream ss;
+    inr::IRPrinter(unit).print(ss);
+    return ss.str();
+}
+
+static int roundTripTest() {
+    inr::TUnit unit("IRParseTest.cpp");
+    inr::TypeMap tm;
+    if(!inr::IRParser::parse(unit, tm, SOURCE, &inr::err())) return 1;
+    if(!inr::Verifier::verify(unit, &inr::err())) return 1;
+
+    std::string printed = print(unit);
+    if(printed != SOURCE) {
+        inr::err() << "Parsed unit differs:\n" << printed << '\n';
+        return 1;
+    }
+
+    // Labels decide the order of the blocks, not their first use.
+    const inr::FuncDef& fn = *++unit.getFuncs().begin();
+    auto blk = fn.getBlocks().begin();
+    if((++blk)->getName() != "head" || !(++blk)->getName().empty()) return 1;
+
+    // The copy is independent of the source buffer.
+    std::string src(SOURCE);
+    inr::TUnit copy("IRParseTest.cpp");
+    if(!inr::IRParser::parse(copy, tm, src, &inr::err())) return 1;
+    src.assign(src.size(), '?');
+    if(print(copy) != SOURCE) return 1;
+
+    // Constants can be written unsigned too, the printer uses signed.
+    inr::TUnit other("");
+    if(!inr::IRParser::parse(other, tm,
+                             "def fn i64 @f() {\nentry:\n"
+                             "    ret i64 18446744073709551615\n}\n",
+                             &inr::err()) ||
+       print(other).find("ret i64 -1") == std::string::npos) {
+        return 1;
+    }
+
+    // The most negative values fit.
+    inr::TUnit mins("");
+    if(!inr::IRParser::parse(mins, tm,
+                             "def fn i8 @a() {\nentry:\n    ret i8 -128\n}\n"
+                             "def fn i100 @b() {\nentry:\n"
+                             "    ret i100 -633825300114114700748351602688\n}\n"
+                             "def fn i128 @c() {\nentry:\n    ret i128 "
+                             "-170141183460469231731687303715884105728\n}\n",
+                             &inr::err())) {
+        return 1;
+    }
+    std::string minsPrinted = print(mins);
+    if(minsPrinted.find("ret i8 -128") == std::string::npos ||
+       minsPrinted.find("-633825300114114700748351602688") ==
+           std::string::npos ||
+       minsPrinted.find("-170141183460469231731687303715884105728") ==
+           std::string::npos) {
+        inr::err() << "Most negative constants print differently:\n"
+                   << minsPrinted << '\n';
+        return 1;
+    }
+
+    return 0;
+}
+
+static int errorTest() {
+    struct {
+        std::string_view src;
+        std::string_view error;
+    } cases[] = {
+        {"def fn i32 @f(", "1:15: expected a type"},
+        {"def fn i32 @f() {\nentry:\n    ret i32 %x\n}\n",
+         "3:13: use of undefined value '%x'"},
+        {"def fn void @f() {\nentry:\n    jmp block %next\n}\n",
+         "3:15: use of undefined block '%next'"},
+        {"def fn i32 @f(i32 %a) {\nentry:\n    %a = i32 add(%a, 1)\n}\n",
+         "3:5: redefinition of '%a'"},
+        {"def fn i8 @f() {\nentry:\n    ret i8 256\n}\n",
+         "3:12: constant doesn't fit in i8"},
+        {"def fn i8 @f() {\nentry:\n    %x = i8 frob(1, 2)\n}\n",
+         "3:13: unknown instruction 'frob'"},
+        {"def fn i8 @f() {\n    ret i8 0\n}\n",
+         "2:5: instruction outside of a block"},
+        {"def fn i8 @f() {\nentry:\n    ret i8 -129\n}\n",
+         "3:12: constant doesn't fit in i8"},
+        {"def fn i8 @f() {\nentry:\n    ret i8 -200\n}\n",
+         "3:12: constant doesn't fit in i8"},
+        {"def fn i8 @f() {\nentry:\n    ret i8 -255\n}\n",
+         "3:12: constant doesn't fit in i8"},
+        {"def fn i64 @f() {\nentry:\n    ret i64 -9223372036854775809\n}\n",
+         "3:13: constant doesn't fit in i64"},
+        {"def fn i100 @f() {\nentry:\n"
+         "    ret i100 -633825300114114700748351602689\n}\n",
+         "3:14: constant doesn't fit in i100"},
+        {"def fn i128 @f() {\nentry:\n"
+         "    ret i128 -170141183460469231731687303715884105729\n}\n",
+         "3:14: constant doesn't fit in i128"},
+        {"def fn i8 @f(i16 %a) {\nentry:\n    ret i8 %a\n}\n",
+         "3:12: '%a' has a different type"},
+        {"def fn i8 @f()\ndef fn i8 @f()\n", "2:11: redefinition of '@f'"},
+        {"def fn ptr @f() {\nentry:\n    ret ptr @g\n}\n",
+         "3:13: use of undefined function '@g'"},
+        {"def fn i0 @f()", "1:8: invalid integer width"},
+        {"fn i32 @f()", "1:1: expected 'def fn'"},
+    };
+
+    for(auto [src, error] : cases) {
+        inr::sstream ss;
+        inr::TUnit unit("IRParseTest.cpp");
+        inr::TypeMap tm;
+        if(inr::IRParser::parse(unit, tm, src, &ss)) {
+            inr::err() << "Bad IR was accepted:\n" << src << '\n';
+            return 1;
+        }
+        if(ss.access().find(error) == std::string::npos) {
+            inr::err() << "Expected '" << error << "', got:\n"
+                       << ss.access() << '\n';
+            return 1;
+        }
+    }
+
+    // Every prefix either parses or fails cleanly.
+    for(std::size_t i = 0; i < SOURCE.size(); i++) {
+        inr::TUnit unit("IRParseTest.cpp");
+        inr::TypeMap tm;
+        inr::IRParser::parse(unit, tm, SOURCE.substr(0, i));
+    }
+
+    return 0;
+}
+
+int main() {
+    if(int res = roundTripTest()) return res;
+    if(int res = errorTest()) return res;
+
+    return 0;
+}
@@ -2,11 +2,63 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/ADT/IVector.h>
+#include <inr/ADT/Relocate.h>
+#include <inr/Math/BigInt.h>
 #include <inr/Support/Stream.h>
+#include <inr/TIR/TOperand.h>
 
+#include <memory>
 #include <string>
+#include <utility>
+
+static_assert(inr::is_trivially_relocatable_v<std::unique_ptr<int>>);
+static_assert(inr::is_trivially_relocatable_v<inr::bigint>);
+static_assert(inr::is_trivially_relocatable_v<inr::TOperand>);
+static_assert(!inr::is_trivially_relocatable_v<inr::ivec<int, 4>>);
+
+template<typename T>
+int relocationTest(T (*make)(int)) {
+    inr::ivec<T, 2> vec;
+    auto value = [](const T& v) -> int { return *v; };
+
+    for(int i = 0; i < 100; i++) vec.push_back(make(i));
+    vec.insert(vec.begin() + 1, make(-1));
+    vec.erase(vec.begin());
+
+    if(vec.size() != 100 || value(vec[0]) != -1) return 1;
+    for(int i = 1; i < 100; i++) {
+        if(value(vec[i]) != i) {
+            inr::err() << "Relocation lost index: " << i << '\n';
+            return 1;
+        }
+    }
+
+    inr::ivec<T, 2> small;
+    small.push_back(make(7));
+    inr::ivec<T, 2> moved(std::move(small));
+    if(!small.empty() || moved.size() != 1 || value(moved[0]) != 7) return 1;
+
+    return 0;
+}
+
+/// @brief Not trivially relocatable, goes through the move path.
+struct Boxed {
+    std::string str_;
+
+    int operator*() const {
+        return std::stoi(str_);
+    }
+};
+
+static_assert(!inr::is_trivially_relocatable_v<Boxed>);
 
 int main() {
+    if(relocationTest<std::unique_ptr<int>>(
+           [](int i) { return std::make_unique<int>(i); }))
+        return 1;
+    if(relocationTest<Boxed>([](int i) { return Boxed{std::to_string(i)}; }))
+        return 1;
+
     inr::ivec<int, 4> on_stack = {1, 2, 3, 4};
 
     if(on_stack[0] != 1) return 1;
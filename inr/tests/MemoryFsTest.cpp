@@ -0,0 +1,152 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+#include <inr/Vfs/FStream.h>
+#include <inr/Vfs/MemoryFs.h>
+#include <inr/Vfs/OverlayFs.h>
+#include <inr/Vfs/Vfs.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+static std::string contents(inr::vfs::Filesystem& fs, std::string_view path) {
+    std::error_code ec;
+    auto m = fs.map(path, inr::vfs::Advice::Normal, ec);
+    return m ? std::string(m->str()) : "<" + ec.message() + ">";
+}
+
+static bool write(inr::vfs::Filesystem& fs, std::string_view path,
+                  std::string_view str, bool append = false) {
+    std::error_code ec;
+    auto f = fs.open(path,
+                     inr::vfs::OpenMode(inr::vfs::OWRITE |
+                                        (append ? inr::vfs::OAPPEND
+                                                : inr::vfs::OTRUNC)),
+                     ec);
+    if(!f) return false;
+    inr::vfsstream os(std::move(f));
+    os << str;
+    return true;
+}
+
+static int memoryTest() {
+    inr::vfs::MemoryFilesystem fs;
+    std::error_code ec;
+
+    // Written through a buffered stream, read back without a copy.
+    if(!write(fs, "a.txt", "hello ") ||
+       !write(fs, "./a.txt", "world", true) ||
+       contents(fs, "a.txt") != "hello world") {
+        inr::err() << "Memory file contents differ\n";
+        return 1;
+    }
+
+    auto f = fs.open("a.txt", inr::vfs::OREAD, ec);
+    char buf[5];
+    if(!f || !f->seek(6, inr::vfs::SSET) || f->read(buf, 5) != 5 ||
+       std::string_view(buf, 5) != "world" || f->read(buf, 5) != 0 ||
+       !f->seek(std::size_t(-5), inr::vfs::SEND) || f->tell() != 6) {
+        inr::err() << "Memory file read/seek is wrong\n";
+        return 1;
+    }
+
+    // Directories need to exist before their files can be created.
+    if(fs.open("dir/b.txt", inr::vfs::OWRITE, ec) ||
+       ec != std::errc::no_such_file_or_directory) {
+        return 1;
+    }
+    if(fs.mkdir("dir/sub") || !write(fs, "dir/b.txt", "b") ||
+       fs.addFile("/abs/c.txt", "c") || contents(fs, "/abs/c.txt") != "c") {
+        return 1;
+    }
+
+    ec.clear();
+    auto names = fs.listDirs("dir", ec);
+    std::sort(names.begin(), names.end());
+    if(ec || names != std::vector<std::string>{"b.txt", "sub"}) {
+        inr::err() << "Memory directory listing is wrong\n";
+        return 1;
+    }
+
+    inr::vfs::FSStat st = fs.stat("dir/b.txt", ec);
+    if(st.getFT() != inr::vfs::FileType::Regular || st.getSize() != 1 ||
+       st.getName() != "b.txt" ||
+       fs.stat("dir", ec).getFT() != inr::vfs::FileType::Directory ||
+       fs.exists("nope") || !fs.exists("/abs")) {
+        inr::err() << "Memory stat is wrong\n";
+        return 1;
+    }
+
+    // A removed file lives on while it's mapped.
+    auto m = fs.map("a.txt", inr::vfs::Advice::Normal, ec);
+    if(fs.rm("a.txt") || fs.exists("a.txt") || !m || !m->isMapped() ||
+       m->str() != "hello world") {
+        return 1;
+    }
+    if(fs.rm("dir") != std::errc::is_a_directory ||
+       fs.rm("a.txt") != std::errc::no_such_file_or_directory ||
+       fs.mkdir("dir/b.txt/x") != std::errc::not_a_directory) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static int overlayTest() {
+    inr::vfs::Filesystem& native = inr::vfs::getNativeFs();
+    if(!write(native, "overlay_lower.txt", "lower")) return 1;
+
+    inr::vfs::MemoryFilesystem mem;
+    inr::vfs::OverlayFilesystem fs(native);
+    fs.pushOverlay(mem);
+    std::error_code ec;
+
+    // New files only go to memory.
+    if(!write(fs, "overlay_upper.txt", "upper") ||
+       contents(fs, "overlay_upper.txt") != "upper" ||
+       native.exists("overlay_upper.txt")) {
+        inr::err() << "Overlay wrote to the lower layer\n";
+        return 1;
+    }
+
+    // Lower files are visible, and copied up once written.
+    if(contents(fs, "overlay_lower.txt") != "lower" ||
+       !write(fs, "overlay_lower.txt", "+", true) ||
+       contents(fs, "overlay_lower.txt") != "lower+" ||
+       contents(native, "overlay_lower.txt") != "lower") {
+        inr::err() << "Overlay copy up is wrong\n";
+        return 1;
+    }
+
+    auto names = fs.listDirs(".", ec);
+    if(ec || std::count(names.begin(), names.end(), "overlay_lower.txt") != 1 ||
+       std::count(names.begin(), names.end(), "overlay_upper.txt") != 1) {
+        inr::err() << "Overlay directory listing is wrong\n";
+        return 1;
+    }
+
+    // Removing the copy uncovers the lower file again.
+    if(fs.rm("overlay_lower.txt") ||
+       contents(fs, "overlay_lower.txt") != "lower") {
+        return 1;
+    }
+    if(fs.rm("overlay_lower.txt") != std::errc::read_only_file_system ||
+       fs.stat("overlay_missing", ec).getFT() !=
+           inr::vfs::FileType::NotFound) {
+        return 1;
+    }
+
+    native.rm("overlay_lower.txt");
+    return 0;
+}
+
+int main() {
+    if(int res = memoryTest()) return res;
+    if(int res = overlayTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/SmallHMap.h>
+#include <inr/Support/Stream.h>
+
+#include <memory>
+#include <utility>
+
+int inlineTest() {
+    inr::SmallHMap<int, int, 4> map;
+
+    for(int i = 0; i < 4; i++) {
+        if(!map.try_emplace(i, i * 2).second) return 1;
+    }
+    if(map.try_emplace(2, 0).second) return 1;
+    if(!map.isSmall() || map.size() != 4) {
+        inr::err() << "Map shouldn't spill before N entries\n";
+        return 1;
+    }
+
+    if(!map.erase(1) || map.erase(1) || map.find(1)) return 1;
+    for(int i : {0, 2, 3}) {
+        auto v = map.find(i);
+        if(!v || *v != i * 2) {
+            inr::err() << "Erasing lost key: " << i << '\n';
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int spillTest() {
+    inr::SmallHMap<int, std::unique_ptr<int>, 2> map;
+
+    for(int i = 0; i < 100; i++) {
+        map.try_emplace(i, std::make_unique<int>(i));
+        if(map.isSmall() != (i < 2)) {
+            inr::err() << "Map spilled at the wrong size: " << i << '\n';
+            return 1;
+        }
+    }
+
+    for(int i = 0; i < 100; i++) {
+        auto v = map.find(i);
+        if(!v || **v != i) {
+            inr::err() << "Spilling lost key: " << i << '\n';
+            return 1;
+        }
+    }
+
+    inr::SmallHMap<int, std::unique_ptr<int>, 2> moved(std::move(map));
+    if(!map.empty() || moved.size() != 100) return 1;
+
+    moved.clear();
+    if(!moved.empty() || moved.find(0)) return 1;
+
+    return 0;
+}
+
+int main() {
+    if(int res = inlineTest()) return res;
+    if(int res = spillTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/Support/Stream.h>
+
+#include <string>
+
+/// @brief Records every write the stream makes.
+class RecordingStream : public inr::stream {
+    void writeImpl(cbuff_t ptr, size_type size) override {
+        writes++;
+        data.append(ptr, size);
+    }
+
+    void writeGatherImpl(cbuff_t head, size_type headSize, cbuff_t ptr,
+                         size_type size) override {
+        gathers++;
+        data.append(head, headSize);
+        data.append(ptr, size);
+    }
+
+public:
+    std::string data;
+    unsigned writes = 0;
+    unsigned gathers = 0;
+
+    RecordingStream(size_type bufferSize) : stream(bufferSize) {}
+
+    ~RecordingStream() override {
+        setUnbuffered();
+    }
+};
+
+int main() {
+    RecordingStream os(16);
+
+    // Small writes stay in the buffer.
+    os << "abc" << "def";
+    if(os.writes || os.gathers || os.getCharsInBuffer() != 6) {
+        inr::err() << "Small writes weren't buffered\n";
+        return 1;
+    }
+    os.flush();
+    if(os.writes != 1 || os.data != "abcdef" || os.getCharsInBuffer() != 0) {
+        inr::err() << "Flush wrote the wrong bytes\n";
+        return 1;
+    }
+
+    // A write that overflows fills the buffer, the rest waits in it.
+    os << "0123456789" << "ABCDEFGHIJ";
+    if(os.writes != 2 || os.data != "abcdef0123456789ABCDEF" ||
+       os.getCharsInBuffer() != 4) {
+        inr::err() << "A full buffer wasn't written\n";
+        return 1;
+    }
+
+    // A large payload goes out together with the buffer.
+    std::string payload(40, 'x');
+    os << payload;
+    if(os.writes != 2 || os.gathers != 1 ||
+       os.data != "abcdef0123456789ABCDEFGHIJ" + payload ||
+       os.getCharsInBuffer() != 0) {
+        inr::err() << "A large write wasn't gathered\n";
+        return 1;
+    }
+
+    // Without a buffer everything is written right away.
+    RecordingStream unbuffered(0);
+    unbuffered << "abc";
+    if(unbuffered.writes != 1 || unbuffered.data != "abc") return 1;
+
+    return 0;
+}
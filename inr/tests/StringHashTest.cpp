@@ -0,0 +1,171 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HMapInfo.h>
+#include <inr/ADT/Hashing.h>
+#include <inr/Support/Stream.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Symbol names as they show up in objects, mangled and not.
+static const char* const SYMBOLS[] = {
+    "main",
+    "_start",
+    "memcpy",
+    "__libc_start_main",
+    "_ZNSt6vectorIiSaIiEE9push_backERKi",
+    "_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1EPKcRKS3_",
+    "_ZN3inr5TUnit14createFunctionEPNS_8FuncTypeESt17basic_string_viewIcSt11"
+    "char_traitsIcEENS_7LinkageENS_7TypeExtE",
+    "_ZN3inr7InstDef8appendToEPNS_8BlockDefE",
+    "_ZN3inr7TypeMap7getFuncEPNS_4TypeESt16initializer_listIS2_Eb",
+    "_ZN3inr4HMapISt17basic_string_viewIcSt11char_traitsIcEEjNS_8HMapInfoIS4_"
+    "EEE11try_emplaceIJRjEEESt4pairIPS7_bERKS4_DpOT_",
+    "_ZNK3inr10StringPool6lookupESt17basic_string_viewIcSt11char_traitsIcEE",
+    "_ZN3inr2fs10Filesystem4openERKNS0_4PathENS0_8OpenModeE",
+    "_ZTVN3inr6ostreamE",
+    "_ZTIN3inr2fs4FileE",
+    "_ZGVZN3inr3outEvE6stream",
+    "_ZdlPvm",
+    "_Znwm",
+    "??0TUnit@inr@@QEAA@V?$basic_string_view@DU?$char_traits@D@std@@@std@@@Z",
+    "?createBlock@TUnit@inr@@QEAAPEAVBlockDef@2@AEAVTypeMap@2@PEAVFuncDef@2@"
+    "V?$basic_string_view@DU?$char_traits@D@std@@@std@@@Z",
+    "llvm.memcpy.p0.p0.i64",
+    ".Lfunc_end0",
+    ".LBB0_1",
+    "entry",
+    "if.then",
+    "for.body",
+    "for.cond.cleanup",
+};
+
+/// @brief The names a compiler generates, which only differ in a few
+/// characters and are the worst case for weak string hashes.
+static std::vector<std::string> makeCorpus() {
+    std::vector<std::string> corpus;
+    for(const char* sym : SYMBOLS) corpus.push_back(sym);
+
+    for(unsigned i = 0; i < 50000; i++) {
+        std::string n = std::to_string(i);
+        corpus.push_back("%" + n);
+        corpus.push_back("tmp." + n);
+        corpus.push_back(".LBB" + std::to_string(i / 100) + "_" +
+                         std::to_string(i % 100));
+        corpus.push_back("_ZN3inr4Pass" + n + "E");
+    }
+    for(const char* sym : SYMBOLS) {
+        for(unsigned i = 0; i < 100; i++) {
+            corpus.push_back(std::string(sym) + "." + std::to_string(i));
+        }
+    }
+    // Long keys that only differ in one byte, anywhere.
+    std::string lng(1000, 'a');
+    for(std::size_t i = 0; i < lng.size(); i++) {
+        std::string copy = lng;
+        copy[i] = 'b';
+        corpus.push_back(std::move(copy));
+    }
+
+    std::sort(corpus.begin(), corpus.end());
+    corpus.erase(std::unique(corpus.begin(), corpus.end()), corpus.end());
+    return corpus;
+}
+
+static int qualityTest() {
+    std::vector<std::string> corpus = makeCorpus();
+
+    // No full collisions.
+    std::vector<std::uint64_t> hashes;
+    for(const std::string& s : corpus) {
+        hashes.push_back(inr::hashBytes(s.data(), s.size()));
+    }
+    std::sort(hashes.begin(), hashes.end());
+    if(std::adjacent_find(hashes.begin(), hashes.end()) != hashes.end()) {
+        inr::err() << "Distinct names hash the same\n";
+        return 1;
+    }
+
+    // The low bits alone, as a small table without mixing would use them,
+    // spread evenly: chi-squared over the buckets stays near their amount.
+    constexpr std::size_t BUCKETS = 1 << 12;
+    std::vector<std::size_t> counts(BUCKETS);
+    for(const std::string& s : corpus) {
+        counts[inr::hashBytes(s.data(), s.size()) % BUCKETS]++;
+    }
+    double expected = double(corpus.size()) / BUCKETS;
+    double chi = 0;
+    for(std::size_t c : counts) {
+        chi += (c - expected) * (c - expected) / expected;
+    }
+    if(chi > BUCKETS * 1.2) {
+        inr::err() << "Low bits are skewed, chi-squared: " << std::size_t(chi)
+                   << '\n';
+        return 1;
+    }
+
+    // Every string keys the maps.
+    inr::HMap<std::string_view, unsigned> map;
+    for(unsigned i = 0; i < corpus.size(); i++) map.try_emplace(corpus[i], i);
+    for(unsigned i = 0; i < corpus.size(); i++) {
+        const unsigned* v = map.find(corpus[i]);
+        if(!v || *v != i) return 1;
+    }
+
+    return 0;
+}
+
+static int pathTest() {
+    std::vector<unsigned char> buf(4200);
+    std::uint32_t seed = 42;
+    for(unsigned char& c : buf) {
+        seed = seed * 1664525 + 1013904223;
+        c = (unsigned char)(seed >> 24);
+    }
+
+    // Every length through the short loops and the long stripes, with the
+    // stripe scramble and tails of every size.
+    for(std::size_t len = 0; len < buf.size() - 8; len++) {
+        std::uint64_t scalar =
+            len >= inr::HASH_LONG_KEY
+                ? inr::internal::hashLongScalar(buf.data(), len, 7)
+                : inr::internal::hashShort(buf.data(), len, 7);
+        std::uint64_t h = inr::hashBytes(buf.data(), len, 7);
+        if(h != scalar) {
+            inr::err() << "SIMD hash differs from scalar, length: " << len
+                       << '\n';
+            return 1;
+        }
+
+        // The same bytes elsewhere hash the same.
+        std::vector<unsigned char> moved(buf.begin(), buf.begin() + len + 3);
+        std::copy(buf.begin(), buf.begin() + len, moved.begin() + 3);
+        if(inr::hashBytes(moved.data() + 3, len, 7) != h) return 1;
+
+        if(inr::hashBytes(buf.data(), len, 8) == h) return 1;
+        if(len && inr::hashBytes(buf.data(), len - 1, 7) == h) return 1;
+    }
+
+    // HMapInfo goes through the same hash, for views and strings alike.
+    std::string s = "_ZN3inr7InstDef8appendToEPNS_8BlockDefE";
+    if(inr::HMapInfo<std::string_view>::hash(s) !=
+           inr::hashBytes(s.data(), s.size()) ||
+       inr::HMapInfo<std::string>::hash(s) !=
+           inr::HMapInfo<std::string_view>::hash(s))
+        return 1;
+
+    return 0;
+}
+
+int main() {
+    if(int res = qualityTest()) return res;
+    if(int res = pathTest()) return res;
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/ADT/HMap.h>
+#include <inr/ADT/HMapInfo.h>
+#include <inr/ADT/StringPool.h>
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/Support/Stream.h>
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+int poolTest() {
+    inr::StringPool pool;
+
+    std::string a = "hello";
+    std::string b = "hello";
+    inr::PooledString pa = pool.intern(a);
+    inr::PooledString pb = pool.intern(b);
+    if(pa != pb || pa.str().data() == a.data()) return 1;
+    if(pa.hash() != inr::HMapInfo<std::string_view>::hash("hello")) return 1;
+    if(std::strcmp(pa.c_str(), "hello") != 0) return 1;
+
+    if(!pool.intern("").empty() || pool.lookup("world") != inr::PooledString())
+        return 1;
+    if(pool.lookup("hello") != pa || pool.size() != 1) return 1;
+
+    // Handles stay valid while the set behind them grows.
+    std::vector<inr::PooledString> handles;
+    for(unsigned i = 0; i < 0x1000; i++) {
+        handles.push_back(pool.intern("name" + std::to_string(i)));
+    }
+    for(unsigned i = 0; i < 0x1000; i++) {
+        std::string expected = "name" + std::to_string(i);
+        if(handles[i].str() != expected ||
+           pool.intern(expected) != handles[i]) {
+            inr::err() << "Handle changed at index: " << i << '\n';
+            return 1;
+        }
+    }
+    if(pool.size() != 0x1001 || pa.str() != "hello") return 1;
+
+    // Handles can key maps without rehashing the characters.
+    inr::HMap<inr::PooledString, unsigned> map;
+    for(unsigned i = 0; i < 0x1000; i++) map.try_emplace(handles[i], i);
+    for(unsigned i = 0; i < 0x1000; i++) {
+        const unsigned* v = map.find(handles[i]);
+        if(!v || *v != i) return 1;
+    }
+
+    return 0;
+}
+
+int unitNamesTest() {
+    inr::TUnit unit("StringPoolTest.cpp");
+    inr::TypeMap tm;
+
+    inr::FuncDef* fn;
+    {
+        // The unit copies the name, the caller's string can go away.
+        std::string name = "function" + std::to_string(42);
+        fn = unit.createFunction(tm.getFunc(tm.getI32(), {tm.getI32()}, false),
+                                 name, inr::Linkage::Global,
+                                 inr::TypeExt::NoExt);
+        name.assign(name.size(), 'x');
+    }
+    if(fn->getName() != "function42") return 1;
+    if(fn->getPooledName() != unit.getNames().lookup("function42")) return 1;
+
+    auto entry = unit.createBlock(tm, fn, "entry");
+    auto arg = fn->getArg(0);
+    {
+        std::string name = "argc";
+        arg->setName(name);
+        name = "gone";
+    }
+    auto add = inr::AddInst::createAdd(entry, arg, arg, "sum");
+    add->setName("argc");
+
+    if(arg->getName() != "argc" || entry->getName() != "entry") return 1;
+    if(add->getPooledName() != arg->getPooledName()) return 1;
+    if(add->getParent() != entry || arg->getParent() != fn) return 1;
+
+    // Renaming back reuses the existing string.
+    std::size_t count = unit.getNames().size();
+    add->setName("sum");
+    if(add->getName() != "sum" || unit.getNames().size() != count) return 1;
+
+    return 0;
+}
+
+int main() {
+    if(int res = poolTest()) return res;
+    if(int res = unitNamesTest()) return res;
+
+    return 0;
+}
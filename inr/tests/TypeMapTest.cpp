@@ -1,9 +1,14 @@
 // Copyright (c) 2026 Inertia Project
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/Type.h>
 #include <inr/IR/TypeMap.h>
+#include <inr/Support/Stream.h>
 
-int main() {
+#include <thread>
+#include <vector>
+
+int uniqueTest() {
     inr::TypeMap tm;
 
     if(tm.getI32() != tm.getI32()) return 1;
@@ -17,5 +22,60 @@ int main() {
 
     if(mt != mt2) return 1;
 
+    // Signatures that only differ in the return type or varargs are distinct.
+    auto mt3 = tm.getFunc(tm.getI64(), {tm.getI32(), tm.getPtr()}, false);
+    auto mt4 = tm.getFunc(tm.getI32(), {tm.getI32(), tm.getPtr()}, true);
+    if(mt3 == mt || mt4 == mt || mt3->getReturn() != tm.getI64()) return 1;
+
+    return 0;
+}
+
+int threadTest() {
+    constexpr unsigned THREADS = 8;
+    constexpr unsigned TYPES = 2000;
+
+    inr::TypeMap tm;
+    std::vector<std::vector<const inr::Type*>> seen(THREADS);
+
+    // Every thread asks for the same types in a different order, creating
+    // most of them concurrently with the others.
+    std::vector<std::thread> threads;
+    for(unsigned t = 0; t < THREADS; t++) {
+        threads.emplace_back([&tm, &seen, t] {
+            std::vector<const inr::Type*>& mine = seen[t];
+            mine.resize(TYPES * 2);
+            for(unsigned n = 0; n < TYPES; n++) {
+                unsigned i = (n * 7 + t * 131) % TYPES;
+                const inr::IntType* it = tm.getInt(i + 2);
+                const inr::Type* args[] = {it, tm.getPtr()};
+                mine[i] = it;
+                mine[TYPES + i] = tm.getFunc(tm.getVoid(), args, false);
+            }
+        });
+    }
+    for(std::thread& th : threads) th.join();
+
+    for(unsigned t = 1; t < THREADS; t++) {
+        if(seen[t] != seen[0]) {
+            inr::err() << "Threads got different types, thread: " << t
+                       << '\n';
+            return 1;
+        }
+    }
+
+    for(unsigned i = 0; i < TYPES; i++) {
+        auto it = (const inr::IntType*)seen[0][i];
+        auto ft = (const inr::FuncType*)seen[0][TYPES + i];
+        if(it != tm.getInt(i + 2) || it->getWidth() != i + 2) return 1;
+        if(ft->getNumArgs() != 2 || ft->getArg(0) != it) return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    if(int res = uniqueTest()) return res;
+    if(int res = threadTest()) return res;
+
     return 0;
 }
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Inertia Project
+// Distributed under the Boost Software License, Version 1.0.
+// See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
+#include <inr/IR/FuncDef.h>
+#include <inr/IR/InstDef.h>
+#include <inr/IR/Linkage.h>
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
+#include <inr/IR/Use.h>
+#include <inr/Support/Stream.h>
+
+#include <vector>
+
+/// @brief Checks that every use in the list is linked back correctly.
+bool checkUsers(const inr::Def* def, unsigned expected) {
+    unsigned count = 0;
+    for(const inr::Use& use : def->getUsers()) {
+        if(use.get() != def) return false;
+        bool found = false;
+        for(const inr::Use& op : use.getUser()->getUses()) {
+            if(&op == &use) found = true;
+        }
+        if(!found) return false;
+        count++;
+    }
+    return count == expected && def->getNumUsers() == expected;
+}
+
+int userListTest() {
+    inr::TUnit unit("UseDefTest.cpp");
+    inr::TypeMap tm;
+
+    auto fn = unit.createFunction(
+        tm.getFunc(tm.getI32(), {tm.getI32(), tm.getI32()}, false), "fn",
+        inr::Linkage::Global, inr::TypeExt::NoExt);
+    auto entry = unit.createBlock(tm, fn, "entry");
+    auto a = fn->getArg(0);
+    auto b = fn->getArg(1);
+
+    std::vector<inr::AddInst*> adds;
+    for(unsigned i = 0; i < 0x100; i++) {
+        adds.push_back(inr::AddInst::createAdd(entry, a, a));
+    }
+
+    if(!checkUsers(a, 0x200) || b->hasUsers()) {
+        inr::err() << "Wrong users after creating instructions\n";
+        return 1;
+    }
+
+    // Removing from the middle of the list.
+    for(unsigned i = 0; i < adds.size(); i += 2) {
+        adds[i]->removeUses();
+        if(!adds[i]->getUses().empty()) {
+            inr::err() << "Uses were not cleared\n";
+            return 1;
+        }
+    }
+
+    if(!checkUsers(a, 0x100)) {
+        inr::err() << "Wrong users after removing uses\n";
+        return 1;
+    }
+
+    adds[1]->setUse(1, b);
+    if(adds[1]->getRhs() != b || !b->hasOneUser() || !checkUsers(a, 0xFF)) {
+        inr::err() << "setUse() didn't update the users\n";
+        return 1;
+    }
+
+    a->replaceAllUsesWith(b);
+    if(a->hasUsers() || !checkUsers(b, 0x100)) {
+        inr::err() << "replaceAllUsesWith() didn't move every use\n";
+        return 1;
+    }
+
+    if(adds[1]->getLhs() != b || adds[3]->getRhs() != b) {
+        inr::err() << "Operands were not replaced\n";
+        return 1;
+    }
+
+    inr::RetInst::createRet(tm, entry, adds[1]);
+    return 0;
+}
+
+int phiGrowthTest() {
+    inr::TUnit unit("UseDefTest.cpp");
+    inr::TypeMap tm;
+
+    auto fn = unit.createFunction(tm.getFunc(tm.getI32(), {tm.getI32()}, false),
+                                  "fn", inr::Linkage::Global,
+                                  inr::TypeExt::NoExt);
+    auto entry = unit.createBlock(tm, fn, "entry");
+    auto exit = unit.createBlock(tm, fn, "exit");
+    auto a = fn->getArg(0);
+
+    inr::JmpInst::createJmp(tm, entry, exit);
+    auto phi = inr::PhiInst::createPhi(exit, tm.getI32());
+    auto add = inr::AddInst::createAdd(exit, a, phi);
+
+    // Grows the operands past the inline storage, moving the uses.
+    for(unsigned i = 0; i < 0x40; i++) {
+        phi->addIncoming(i % 2 ? (inr::Def*)a : (inr::Def*)add, entry);
+    }
+
+    if(!checkUsers(a, 0x21) || !checkUsers(add, 0x20) ||
+       !checkUsers(phi, 1)) {
+        inr::err() << "Uses were not relinked when growing\n";
+        return 1;
+    }
+
+    add->replaceAllUsesWith(a);
+    if(add->hasUsers() || !checkUsers(a, 0x41)) {
+        inr::err() << "replaceAllUsesWith() on phi failed\n";
+        return 1;
+    }
+
+    for(unsigned i = 0; i < phi->getIncomingCount(); i++) {
+        if(phi->getIncoming(i).first != a) return 1;
+    }
+
+    inr::RetInst::createRet(tm, exit, phi);
+    return 0;
+}
+
+int main() {
+    if(int res = userListTest()) return res;
+    if(int res = phiGrowthTest()) return res;
+
+    return 0;
+}
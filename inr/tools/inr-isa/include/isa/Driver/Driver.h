@@ -9,10 +9,13 @@
 /// @brief Provides the `inr-isa` driver.
 
 #include <inr/Support/Stream.h>
+#include <inr/Vfs/Vfs.h>
 
 namespace isa {
 
 class Driver {
+    inr::vfs::Filesystem& fs_;
+
     template<typename... Args>
     static void printError(Args&&... args) {
         ((inr::err() << "inr-isa: ").changeColor(inr::col::RED, true)
@@ -26,6 +29,10 @@ class Driver {
     static void printVersion();
 
 public:
+    /// @param fs Filesystem the input and the output are in.
+    explicit Driver(inr::vfs::Filesystem& fs = inr::vfs::getNativeFs()) :
+        fs_(fs) {}
+
     int isaMain(int, char**);
 };
 
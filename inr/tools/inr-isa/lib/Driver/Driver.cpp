@@ -112,13 +112,11 @@ int Driver::isaMain(int argc, char** argv) {
 
     if(err) return 1;
 
-    auto& vfs = inr::vfs::getNativeFs();
-
     std::string_view inputFile =
         optsParser.getLast(uint32_t(ISAOpt::Input)).value;
 
     std::error_code ec;
-    auto inputStat = vfs.stat(inputFile, ec);
+    auto inputStat = fs_.stat(inputFile, ec);
 
     if(ec != std::error_code()) {
         printError("failed to stat file '", inputFile,
@@ -145,22 +143,14 @@ int Driver::isaMain(int argc, char** argv) {
             return 1;
     }
 
-    std::size_t fileSize = inputStat.getSize();
-    std::unique_ptr<char[]> fileMap(std::make_unique<char[]>(fileSize));
-
-    auto file = vfs.open(inputFile, inr::vfs::OpenMode::OREAD, ec);
-    if(ec != std::error_code()) {
+    auto fileMap = fs_.map(inputFile, inr::vfs::Advice::Sequential, ec);
+    if(!fileMap) {
         printError("failed to open file '", inputFile,
                    "' reason: ", ec.message());
         return 1;
     }
 
-    if(std::size_t b = file->read(fileMap.get(), fileSize); b != fileSize) {
-        printError("file size is ", fileSize, " but only ", b, " was read");
-        return 1;
-    }
-
-    Lexer lexer(fileMap.get(), fileMap.get() + fileSize, inputFile);
+    Lexer lexer(fileMap->begin(), fileMap->end(), inputFile);
 
     Diag diag;
     Parser parser(lexer, diag);
@@ -204,15 +194,15 @@ int Driver::isaMain(int argc, char** argv) {
         }
 
         auto outputOpt = optsParser.getLast(uint32_t(ISAOpt::Output));
-        auto outputFile = vfs.open(
-            outputOpt.value,
-            inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC), ec);
-        if(ec != std::error_code{}) {
+        // Only replaces the output once it's fully written.
+        auto outputFile = fs_.createOutput(outputOpt.value, 0, ec);
+        if(!outputFile) {
             printError("couldn't open file '", outputOpt.value,
                        "' with reason: ", ec.message());
             return 1;
         }
 
+        inr::vfs::OutputFile& output = *outputFile;
         inr::vfsstream fs(std::move(outputFile));
         if(optsParser.has(uint32_t(ISAOpt::IncludeLicense))) {
             fs << "// Copyright (c) 2026 Inertia Project\n// Distributed under "
@@ -221,6 +211,13 @@ int Driver::isaMain(int argc, char** argv) {
         }
 
         emitter->emitter->emit(fs, expr);
+
+        fs.flush();
+        if((ec = output.commit())) {
+            printError("couldn't write file '", outputOpt.value,
+                       "' with reason: ", ec.message());
+            return 1;
+        }
     }
     else {
         printError("no emitter chosen");
@@ -8,16 +8,23 @@
 /// @file Driver/Driver.h
 /// @brief Provides the `inr-randir` driver class.
 
+#include <inr/IR/TUnit.h>
+#include <inr/IR/TypeMap.h>
 #include <inr/Support/Stream.h>
 #include <inr/Vfs/FStream.h>
+#include <inr/Vfs/Vfs.h>
 
 #include <memory>
+#include <string_view>
 
 namespace randir {
 
 class Driver {
+    inr::vfs::Filesystem& fs_;
     inr::stream* output_;
     std::unique_ptr<inr::vfsstream> maybeFile_;
+    /// @brief The file `maybeFile_` writes to, committed once it's done.
+    inr::vfs::OutputFile* outputFile_ = nullptr;
 
     template<typename... Args>
     static void printError(Args&&... args) {
@@ -31,7 +38,15 @@ class Driver {
     static void printHelp();
     static void printVersion();
 
+    /// @brief Parses the IR in the file at `path` into `unit`.
+    bool readInput(std::string_view path, inr::TUnit& unit,
+                   inr::TypeMap& tm);
+
 public:
+    /// @param fs Filesystem the inputs and the output are in.
+    explicit Driver(inr::vfs::Filesystem& fs = inr::vfs::getNativeFs()) :
+        fs_(fs) {}
+
     int randirMain(int argc, char** argv);
 };
 
@@ -2,6 +2,7 @@
 // Distributed under the Boost Software License, Version 1.0.
 // See LICENSE file or https://www.boost.org/LICENSE_1_0.txt
 #include <inr/CLI/CTOpts.h>
+#include <inr/IR/Parser.h>
 #include <inr/IR/Printer.h>
 #include <inr/IR/TUnit.h>
 #include <inr/IR/Type.h>
@@ -13,8 +14,9 @@
 #include <randir/IR/IRGen.h>
 
 #include <charconv>
-#include <deque>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace randir {
@@ -49,14 +51,54 @@ void Driver::printVersion() {
                << '\n';
 }
 
-static inline std::string& generateName(std::deque<std::string>& names,
-                                        std::string_view prefix) {
-    unsigned c = names.size();
-    std::string& str = names.emplace_back(prefix);
+/// @note The unit interns the name, so it only has to live for the call.
+static inline std::string generateName(std::string_view prefix, unsigned c) {
+    std::string str(prefix);
     str += std::to_string(c);
     return str;
 }
 
+bool Driver::readInput(std::string_view path, inr::TUnit& unit,
+                       inr::TypeMap& tm) {
+    std::error_code ec;
+
+    auto inputStat = fs_.stat(path, ec);
+    if(ec != std::error_code()) {
+        printError("failed to stat file '", path, "' reason: ", ec.message());
+        return false;
+    }
+
+    switch(inputStat.getFT()) {
+        case inr::vfs::FileType::None:
+        case inr::vfs::FileType::NotFound:
+            printError("file '", path, "' not found");
+            return false;
+        case inr::vfs::FileType::Regular:
+        case inr::vfs::FileType::Symlink:
+            break;
+        case inr::vfs::FileType::Directory:
+            printError('\'', path, "' is a directory");
+            return false;
+        case inr::vfs::FileType::CharacterDevice:
+        case inr::vfs::FileType::FIFO:
+        case inr::vfs::FileType::Socket:
+            printError('\'', path, "' is not a regular file");
+            return false;
+    }
+
+    auto fileMap = fs_.map(path, inr::vfs::Advice::Sequential, ec);
+    if(!fileMap) {
+        printError("failed to open file '", path, "' reason: ", ec.message());
+        return false;
+    }
+
+    if(!inr::IRParser::parse(unit, tm, fileMap->str(), &inr::err())) {
+        printError("failed to parse '", path, '\'');
+        return false;
+    }
+    return true;
+}
+
 int Driver::randirMain(int argc, char** argv) {
     output_ = &inr::out();
 
@@ -76,11 +118,6 @@ int Driver::randirMain(int argc, char** argv) {
 
     bool err = false;
 
-    if(optsParser.has(uint32_t(RandIROptKind::Input))) {
-        err = true;
-        printError("input files are not supported");
-    }
-
     if(optsParser.has(uint32_t(RandIROptKind::StdinInput))) {
         err = true;
         printError("stdin input is not supported");
@@ -105,19 +142,17 @@ int Driver::randirMain(int argc, char** argv) {
         const inr::CTOptVal& out =
             optsParser.getLast(uint32_t(RandIROptKind::Output));
 
-        auto& vfs = inr::vfs::getNativeFs();
-
         std::error_code ec;
 
-        auto f = vfs.open(
-            out.value, inr::vfs::OpenMode(inr::vfs::OWRITE | inr::vfs::OTRUNC),
-            ec);
+        // Only replaces the output once it's fully written.
+        auto f = fs_.createOutput(out.value, 0, ec);
         if(!f) {
             printError("error opening '", out.value,
                        "' with message: ", ec.message());
             return 1;
         }
 
+        outputFile_ = f.get();
         maybeFile_ = std::make_unique<inr::vfsstream>(std::move(f));
     }
 
@@ -175,9 +210,15 @@ int Driver::randirMain(int argc, char** argv) {
 
     inr::TUnit unit(unitName);
     inr::TypeMap tm;
-    IRGen gen(tm);
 
-    std::deque<std::string> functionNames;
+    // The inputs go first, the random functions are added after them.
+    if(optsParser.has(uint32_t(RandIROptKind::Input))) {
+        for(auto input : optsParser.get(uint32_t(RandIROptKind::Input))) {
+            if(!readInput(input->value, unit, tm)) return 1;
+        }
+    }
+
+    IRGen gen(tm);
 
     for(unsigned i = 0; i < functionCount; i++) {
         unsigned funcArgCount = gen.getRand32(0, argCount);
@@ -187,9 +228,8 @@ int Driver::randirMain(int argc, char** argv) {
         }
         const inr::FuncType* ft = tm.getFunc(gen.randomReturnType(bitmax),
                                              argTypes, gen.getRandBool());
-        auto func =
-            unit.createFunction(ft, generateName(functionNames, "function"),
-                                gen.getRandLinkage(), gen.getRandExt());
+        auto func = unit.createFunction(ft, generateName("function", i),
+                                        gen.getRandLinkage(), gen.getRandExt());
         for(unsigned j = 0; j < funcArgCount; j++) {
             func->getArg(j)->setExt(gen.getRandExt());
         }
@@ -198,6 +238,15 @@ int Driver::randirMain(int argc, char** argv) {
     inr::IRPrinter printer(unit);
     printer.print(*output_);
 
+    if(outputFile_) {
+        maybeFile_->flush();
+        if(std::error_code ec = outputFile_->commit()) {
+            printError("error writing '", outputFile_->getPath(),
+                       "' with message: ", ec.message());
+            return 1;
+        }
+    }
+
     return 0;
 }
 